@@ -0,0 +1,207 @@
+#pragma once
+
+// Generated by tools/img_pack.py from --test-card 160x120 --flat --format pal4 - do not edit
+// 160x120 pal4, 3040 bytes (5.3% of 57600 raw RGB666 bytes)
+
+#include <cstddef>
+#include <cstdint>
+
+namespace assets {
+
+/// FNV-1a of the decoded RGB666 bytes (ImageDecoder output)
+constexpr uint32_t test_card_pal4_hash = 0x31BF7445;
+
+alignas(4) static const uint8_t test_card_pal4[3040] = {
+    0x50, 0x49, 0x4D, 0x47, 0x01, 0x01, 0xA0, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x09, 0x09, 0x09, 0x12, 0x12, 0x12, 0x1B, 0x1B,
+    0x1B, 0x24, 0x24, 0x24, 0x2D, 0x2D, 0x2D, 0x36, 0x36, 0x36, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F,
+    0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x3F, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0x93, 0x00, 0x93, 0x0D, 0x93, 0x0C, 0x93, 0x03, 0x93, 0x02, 0x93, 0x0B,
+    0x93, 0x0A, 0x93, 0x01, 0xA7, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x93, 0x0D, 0x93, 0x00, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07, 0x93, 0x08,
+    0x93, 0x09, 0x9B, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x8F, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x8F, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x8F, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x8F, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x8F, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+    0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D, 0x87, 0x00, 0x87, 0x0D,
+};
+
+} // namespace assets
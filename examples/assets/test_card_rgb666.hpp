@@ -0,0 +1,371 @@
+#pragma once
+
+// Generated by tools/img_pack.py from --test-card 160x120 - do not edit
+// 160x120 rgb666, 5653 bytes (9.8% of 57600 raw RGB666 bytes)
+
+#include <cstddef>
+#include <cstdint>
+
+namespace assets {
+
+/// FNV-1a of the decoded RGB666 bytes (ImageDecoder output)
+constexpr uint32_t test_card_rgb666_hash = 0xE10060C5;
+
+alignas(4) static const uint8_t test_card_rgb666[5653] = {
+    0x50, 0x49, 0x4D, 0x47, 0x01, 0x00, 0xA0, 0x00, 0x78, 0x00, 0x00, 0x00, 0x55, 0xD2, 0x6B, 0xD2,
+    0x79, 0xD2, 0x6B, 0xD2, 0x5D, 0xD2, 0x6B, 0xD2, 0x79, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xD2, 0x31, 0xD2, 0x38, 0xD2,
+    0x34, 0xD2, 0x3B, 0xD2, 0x36, 0xD2, 0x3D, 0xD2, 0x39, 0xD2, 0x00, 0xE6, 0xA9, 0x88, 0xD2, 0xA9,
+    0x88, 0xD2, 0xA9, 0x88, 0xD2, 0xA9, 0x88, 0xD2, 0xA9, 0x88, 0xD2, 0xA9, 0x88, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xD2,
+    0x00, 0xD2, 0x07, 0xD2, 0x0E, 0xD2, 0x15, 0xD2, 0x1C, 0xD2, 0x23, 0xD2, 0x2A, 0xD2, 0x31, 0xDA,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xCE, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xCE, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6, 0x00, 0xC6, 0x31, 0xC6,
+    0x00, 0xC6, 0xFF, 0x00, 0x20, 0x30, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x30, 0xC1, 0x33, 0xC0, 0x36, 0xC1, 0x39, 0xC0, 0x3C, 0xC1, 0x3F,
+    0xC0, 0x02, 0xC1, 0x05, 0xC0, 0x08, 0xC1, 0x0B, 0xC0, 0x0E, 0xC1, 0x11, 0xC0, 0x14, 0xC1, 0x17,
+    0xC0, 0x1A, 0xC1, 0x1D, 0xC0, 0x20, 0xC1, 0x23, 0xC0, 0x26, 0xC1, 0x29, 0xC0, 0x2C, 0xC1, 0x2F,
+    0xC0, 0x32, 0xC1, 0x35, 0xC0, 0x38, 0xC1, 0x3B, 0xC0, 0x3E, 0xC1, 0x01, 0xC0, 0x04, 0xC1, 0x07,
+    0xC0, 0x0A, 0xC1, 0x0D, 0xC0, 0x10, 0xC1, 0x13, 0xC0, 0x16, 0xC1, 0x19, 0xC0, 0x1C, 0xC1, 0x1F,
+    0xC0, 0x22, 0xC1, 0x25, 0xC0, 0x28, 0xC1, 0x2B, 0xC0, 0x2E, 0xC1, 0x31, 0xC0, 0x34, 0xC1, 0x37,
+    0xC0, 0x3A, 0xC1, 0x3D, 0xC0, 0x00, 0xC1, 0x03, 0xC0, 0x06, 0xC1, 0x09, 0xC0, 0x0C, 0xC1, 0x0F,
+    0xC0, 0x12, 0xC1, 0x15, 0xC0, 0x18, 0xC1, 0x1B, 0xC0, 0x1E, 0xC1, 0x21, 0xC0, 0x24, 0xC1, 0x27,
+    0xC0, 0x2A, 0xC1, 0x2D, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x37, 0xC1, 0x3A, 0xC0, 0x3D, 0xC1, 0x00, 0xC0, 0x03, 0xC1, 0x06,
+    0xC0, 0x09, 0xC1, 0x0C, 0xC0, 0x0F, 0xC1, 0x12, 0xC0, 0x15, 0xC1, 0x18, 0xC0, 0x1B, 0xC1, 0x1E,
+    0xC0, 0x21, 0xC1, 0x24, 0xC0, 0x27, 0xC1, 0x2A, 0xC0, 0x2D, 0xC1, 0x30, 0xC0, 0x33, 0xC1, 0x36,
+    0xC0, 0x39, 0xC1, 0x3C, 0xC0, 0x3F, 0xC1, 0x02, 0xC0, 0x05, 0xC1, 0x08, 0xC0, 0x0B, 0xC1, 0x0E,
+    0xC0, 0x11, 0xC1, 0x14, 0xC0, 0x17, 0xC1, 0x1A, 0xC0, 0x1D, 0xC1, 0x20, 0xC0, 0x23, 0xC1, 0x26,
+    0xC0, 0x29, 0xC1, 0x2C, 0xC0, 0x2F, 0xC1, 0x32, 0xC0, 0x35, 0xC1, 0x38, 0xC0, 0x3B, 0xC1, 0x3E,
+    0xC0, 0x01, 0xC1, 0x04, 0xC0, 0x07, 0xC1, 0x0A, 0xC0, 0x0D, 0xC1, 0x10, 0xC0, 0x13, 0xC1, 0x16,
+    0xC0, 0x19, 0xC1, 0x1C, 0xC0, 0x1F, 0xC1, 0x22, 0xC0, 0x25, 0xC1, 0x28, 0xC0, 0x2B, 0xC1, 0x2E,
+    0xC0, 0x31, 0xC1, 0x34, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x3E, 0xC1, 0x01, 0xC0, 0x04, 0xC1, 0x07, 0xC0, 0x0A, 0xC1, 0x0D,
+    0xC0, 0x10, 0xC1, 0x13, 0xC0, 0x16, 0xC1, 0x19, 0xC0, 0x1C, 0xC1, 0x1F, 0xC0, 0x22, 0xC1, 0x25,
+    0xC0, 0x28, 0xC1, 0x2B, 0xC0, 0x2E, 0xC1, 0x31, 0xC0, 0x34, 0xC1, 0x37, 0xC0, 0x3A, 0xC1, 0x3D,
+    0xC0, 0x00, 0xC1, 0x03, 0xC0, 0x06, 0xC1, 0x09, 0xC0, 0x0C, 0xC1, 0x0F, 0xC0, 0x12, 0xC1, 0x15,
+    0xC0, 0x18, 0xC1, 0x1B, 0xC0, 0x1E, 0xC1, 0x21, 0xC0, 0x24, 0xC1, 0x27, 0xC0, 0x2A, 0xC1, 0x2D,
+    0xC0, 0x30, 0xC1, 0x33, 0xC0, 0x36, 0xC1, 0x39, 0xC0, 0x3C, 0xC1, 0x3F, 0xC0, 0x02, 0xC1, 0x05,
+    0xC0, 0x08, 0xC1, 0x0B, 0xC0, 0x0E, 0xC1, 0x11, 0xC0, 0x14, 0xC1, 0x17, 0xC0, 0x1A, 0xC1, 0x1D,
+    0xC0, 0x20, 0xC1, 0x23, 0xC0, 0x26, 0xC1, 0x29, 0xC0, 0x2C, 0xC1, 0x2F, 0xC0, 0x32, 0xC1, 0x35,
+    0xC0, 0x38, 0xC1, 0x3B, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x05, 0xC1, 0x08, 0xC0, 0x0B, 0xC1, 0x0E, 0xC0, 0x11, 0xC1, 0x14,
+    0xC0, 0x17, 0xC1, 0x1A, 0xC0, 0x1D, 0xC1, 0x20, 0xC0, 0x23, 0xC1, 0x26, 0xC0, 0x29, 0xC1, 0x2C,
+    0xC0, 0x2F, 0xC1, 0x32, 0xC0, 0x35, 0xC1, 0x38, 0xC0, 0x3B, 0xC1, 0x3E, 0xC0, 0x01, 0xC1, 0x04,
+    0xC0, 0x07, 0xC1, 0x0A, 0xC0, 0x0D, 0xC1, 0x10, 0xC0, 0x13, 0xC1, 0x16, 0xC0, 0x19, 0xC1, 0x1C,
+    0xC0, 0x1F, 0xC1, 0x22, 0xC0, 0x25, 0xC1, 0x28, 0xC0, 0x2B, 0xC1, 0x2E, 0xC0, 0x31, 0xC1, 0x34,
+    0xC0, 0x37, 0xC1, 0x3A, 0xC0, 0x3D, 0xC1, 0x00, 0xC0, 0x03, 0xC1, 0x06, 0xC0, 0x09, 0xC1, 0x0C,
+    0xC0, 0x0F, 0xC1, 0x12, 0xC0, 0x15, 0xC1, 0x18, 0xC0, 0x1B, 0xC1, 0x1E, 0xC0, 0x21, 0xC1, 0x24,
+    0xC0, 0x27, 0xC1, 0x2A, 0xC0, 0x2D, 0xC1, 0x30, 0xC0, 0x33, 0xC1, 0x36, 0xC0, 0x39, 0xC1, 0x3C,
+    0xC0, 0x3F, 0xC1, 0x02, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x13, 0xC1, 0x16, 0xC0, 0x19, 0xC1, 0x1C, 0xC0, 0x1F, 0xC1, 0x22,
+    0xC0, 0x25, 0xC1, 0x28, 0xC0, 0x2B, 0xC1, 0x2E, 0xC0, 0x31, 0xC1, 0x34, 0xC0, 0x37, 0xC1, 0x3A,
+    0xC0, 0x3D, 0xC1, 0x00, 0xC0, 0x03, 0xC1, 0x06, 0xC0, 0x09, 0xC1, 0x0C, 0xC0, 0x0F, 0xC1, 0x12,
+    0xC0, 0x15, 0xC1, 0x18, 0xC0, 0x1B, 0xC1, 0x1E, 0xC0, 0x21, 0xC1, 0x24, 0xC0, 0x27, 0xC1, 0x2A,
+    0xC0, 0x2D, 0xC1, 0x30, 0xC0, 0x33, 0xC1, 0x36, 0xC0, 0x39, 0xC1, 0x3C, 0xC0, 0x3F, 0xC1, 0x02,
+    0xC0, 0x05, 0xC1, 0x08, 0xC0, 0x0B, 0xC1, 0x0E, 0xC0, 0x11, 0xC1, 0x14, 0xC0, 0x17, 0xC1, 0x1A,
+    0xC0, 0x1D, 0xC1, 0x20, 0xC0, 0x23, 0xC1, 0x26, 0xC0, 0x29, 0xC1, 0x2C, 0xC0, 0x2F, 0xC1, 0x32,
+    0xC0, 0x35, 0xC1, 0x38, 0xC0, 0x3B, 0xC1, 0x3E, 0xC0, 0x01, 0xC1, 0x04, 0xC0, 0x07, 0xC1, 0x0A,
+    0xC0, 0x0D, 0xC1, 0x10, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x1A, 0xC1, 0x1D, 0xC0, 0x20, 0xC1, 0x23, 0xC0, 0x26, 0xC1, 0x29,
+    0xC0, 0x2C, 0xC1, 0x2F, 0xC0, 0x32, 0xC1, 0x35, 0xC0, 0x38, 0xC1, 0x3B, 0xC0, 0x3E, 0xC1, 0x01,
+    0xC0, 0x04, 0xC1, 0x07, 0xC0, 0x0A, 0xC1, 0x0D, 0xC0, 0x10, 0xC1, 0x13, 0xC0, 0x16, 0xC1, 0x19,
+    0xC0, 0x1C, 0xC1, 0x1F, 0xC0, 0x22, 0xC1, 0x25, 0xC0, 0x28, 0xC1, 0x2B, 0xC0, 0x2E, 0xC1, 0x31,
+    0xC0, 0x34, 0xC1, 0x37, 0xC0, 0x3A, 0xC1, 0x3D, 0xC0, 0x00, 0xC1, 0x03, 0xC0, 0x06, 0xC1, 0x09,
+    0xC0, 0x0C, 0xC1, 0x0F, 0xC0, 0x12, 0xC1, 0x15, 0xC0, 0x18, 0xC1, 0x1B, 0xC0, 0x1E, 0xC1, 0x21,
+    0xC0, 0x24, 0xC1, 0x27, 0xC0, 0x2A, 0xC1, 0x2D, 0xC0, 0x30, 0xC1, 0x33, 0xC0, 0x36, 0xC1, 0x39,
+    0xC0, 0x3C, 0xC1, 0x3F, 0xC0, 0x02, 0xC1, 0x05, 0xC0, 0x08, 0xC1, 0x0B, 0xC0, 0x0E, 0xC1, 0x11,
+    0xC0, 0x14, 0xC1, 0x17, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x21, 0xC1, 0x24, 0xC0, 0x27, 0xC1, 0x2A, 0xC0, 0x2D, 0xC1, 0x30,
+    0xC0, 0x33, 0xC1, 0x36, 0xC0, 0x39, 0xC1, 0x3C, 0xC0, 0x3F, 0xC1, 0x02, 0xC0, 0x05, 0xC1, 0x08,
+    0xC0, 0x0B, 0xC1, 0x0E, 0xC0, 0x11, 0xC1, 0x14, 0xC0, 0x17, 0xC1, 0x1A, 0xC0, 0x1D, 0xC1, 0x20,
+    0xC0, 0x23, 0xC1, 0x26, 0xC0, 0x29, 0xC1, 0x2C, 0xC0, 0x2F, 0xC1, 0x32, 0xC0, 0x35, 0xC1, 0x38,
+    0xC0, 0x3B, 0xC1, 0x3E, 0xC0, 0x01, 0xC1, 0x04, 0xC0, 0x07, 0xC1, 0x0A, 0xC0, 0x0D, 0xC1, 0x10,
+    0xC0, 0x13, 0xC1, 0x16, 0xC0, 0x19, 0xC1, 0x1C, 0xC0, 0x1F, 0xC1, 0x22, 0xC0, 0x25, 0xC1, 0x28,
+    0xC0, 0x2B, 0xC1, 0x2E, 0xC0, 0x31, 0xC1, 0x34, 0xC0, 0x37, 0xC1, 0x3A, 0xC0, 0x3D, 0xC1, 0x00,
+    0xC0, 0x03, 0xC1, 0x06, 0xC0, 0x09, 0xC1, 0x0C, 0xC0, 0x0F, 0xC1, 0x12, 0xC0, 0x15, 0xC1, 0x18,
+    0xC0, 0x1B, 0xC1, 0x1E, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x28, 0xC1, 0x2B, 0xC0, 0x2E, 0xC1, 0x31, 0xC0, 0x34, 0xC1, 0x37,
+    0xC0, 0x3A, 0xC1, 0x3D, 0xC0, 0x00, 0xC1, 0x03, 0xC0, 0x06, 0xC1, 0x09, 0xC0, 0x0C, 0xC1, 0x0F,
+    0xC0, 0x12, 0xC1, 0x15, 0xC0, 0x18, 0xC1, 0x1B, 0xC0, 0x1E, 0xC1, 0x21, 0xC0, 0x24, 0xC1, 0x27,
+    0xC0, 0x2A, 0xC1, 0x2D, 0xC0, 0x30, 0xC1, 0x33, 0xC0, 0x36, 0xC1, 0x39, 0xC0, 0x3C, 0xC1, 0x3F,
+    0xC0, 0x02, 0xC1, 0x05, 0xC0, 0x08, 0xC1, 0x0B, 0xC0, 0x0E, 0xC1, 0x11, 0xC0, 0x14, 0xC1, 0x17,
+    0xC0, 0x1A, 0xC1, 0x1D, 0xC0, 0x20, 0xC1, 0x23, 0xC0, 0x26, 0xC1, 0x29, 0xC0, 0x2C, 0xC1, 0x2F,
+    0xC0, 0x32, 0xC1, 0x35, 0xC0, 0x38, 0xC1, 0x3B, 0xC0, 0x3E, 0xC1, 0x01, 0xC0, 0x04, 0xC1, 0x07,
+    0xC0, 0x0A, 0xC1, 0x0D, 0xC0, 0x10, 0xC1, 0x13, 0xC0, 0x16, 0xC1, 0x19, 0xC0, 0x1C, 0xC1, 0x1F,
+    0xC0, 0x22, 0xC1, 0x25, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x2F, 0xC1, 0x32, 0xC0, 0x35, 0xC1, 0x38, 0xC0, 0x3B, 0xC1, 0x3E,
+    0xC0, 0x01, 0xC1, 0x04, 0xC0, 0x07, 0xC1, 0x0A, 0xC0, 0x0D, 0xC1, 0x10, 0xC0, 0x13, 0xC1, 0x16,
+    0xC0, 0x19, 0xC1, 0x1C, 0xC0, 0x1F, 0xC1, 0x22, 0xC0, 0x25, 0xC1, 0x28, 0xC0, 0x2B, 0xC1, 0x2E,
+    0xC0, 0x31, 0xC1, 0x34, 0xC0, 0x37, 0xC1, 0x3A, 0xC0, 0x3D, 0xC1, 0x00, 0xC0, 0x03, 0xC1, 0x06,
+    0xC0, 0x09, 0xC1, 0x0C, 0xC0, 0x0F, 0xC1, 0x12, 0xC0, 0x15, 0xC1, 0x18, 0xC0, 0x1B, 0xC1, 0x1E,
+    0xC0, 0x21, 0xC1, 0x24, 0xC0, 0x27, 0xC1, 0x2A, 0xC0, 0x2D, 0xC1, 0x30, 0xC0, 0x33, 0xC1, 0x36,
+    0xC0, 0x39, 0xC1, 0x3C, 0xC0, 0x3F, 0xC1, 0x02, 0xC0, 0x05, 0xC1, 0x08, 0xC0, 0x0B, 0xC1, 0x0E,
+    0xC0, 0x11, 0xC1, 0x14, 0xC0, 0x17, 0xC1, 0x1A, 0xC0, 0x1D, 0xC1, 0x20, 0xC0, 0x23, 0xC1, 0x26,
+    0xC0, 0x29, 0xC1, 0x2C, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x36, 0xC1, 0x39, 0xC0, 0x3C, 0xC1, 0x3F, 0xC0, 0x02, 0xC1, 0x05,
+    0xC0, 0x08, 0xC1, 0x0B, 0xC0, 0x0E, 0xC1, 0x11, 0xC0, 0x14, 0xC1, 0x17, 0xC0, 0x1A, 0xC1, 0x1D,
+    0xC0, 0x20, 0xC1, 0x23, 0xC0, 0x26, 0xC1, 0x29, 0xC0, 0x2C, 0xC1, 0x2F, 0xC0, 0x32, 0xC1, 0x35,
+    0xC0, 0x38, 0xC1, 0x3B, 0xC0, 0x3E, 0xC1, 0x01, 0xC0, 0x04, 0xC1, 0x07, 0xC0, 0x0A, 0xC1, 0x0D,
+    0xC0, 0x10, 0xC1, 0x13, 0xC0, 0x16, 0xC1, 0x19, 0xC0, 0x1C, 0xC1, 0x1F, 0xC0, 0x22, 0xC1, 0x25,
+    0xC0, 0x28, 0xC1, 0x2B, 0xC0, 0x2E, 0xC1, 0x31, 0xC0, 0x34, 0xC1, 0x37, 0xC0, 0x3A, 0xC1, 0x3D,
+    0xC0, 0x00, 0xC1, 0x03, 0xC0, 0x06, 0xC1, 0x09, 0xC0, 0x0C, 0xC1, 0x0F, 0xC0, 0x12, 0xC1, 0x15,
+    0xC0, 0x18, 0xC1, 0x1B, 0xC0, 0x1E, 0xC1, 0x21, 0xC0, 0x24, 0xC1, 0x27, 0xC0, 0x2A, 0xC1, 0x2D,
+    0xC0, 0x30, 0xC1, 0x33, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x04, 0xC1, 0x07, 0xC0, 0x0A, 0xC1, 0x0D, 0xC0, 0x10, 0xC1, 0x13,
+    0xC0, 0x16, 0xC1, 0x19, 0xC0, 0x1C, 0xC1, 0x1F, 0xC0, 0x22, 0xC1, 0x25, 0xC0, 0x28, 0xC1, 0x2B,
+    0xC0, 0x2E, 0xC1, 0x31, 0xC0, 0x34, 0xC1, 0x37, 0xC0, 0x3A, 0xC1, 0x3D, 0xC0, 0x00, 0xC1, 0x03,
+    0xC0, 0x06, 0xC1, 0x09, 0xC0, 0x0C, 0xC1, 0x0F, 0xC0, 0x12, 0xC1, 0x15, 0xC0, 0x18, 0xC1, 0x1B,
+    0xC0, 0x1E, 0xC1, 0x21, 0xC0, 0x24, 0xC1, 0x27, 0xC0, 0x2A, 0xC1, 0x2D, 0xC0, 0x30, 0xC1, 0x33,
+    0xC0, 0x36, 0xC1, 0x39, 0xC0, 0x3C, 0xC1, 0x3F, 0xC0, 0x02, 0xC1, 0x05, 0xC0, 0x08, 0xC1, 0x0B,
+    0xC0, 0x0E, 0xC1, 0x11, 0xC0, 0x14, 0xC1, 0x17, 0xC0, 0x1A, 0xC1, 0x1D, 0xC0, 0x20, 0xC1, 0x23,
+    0xC0, 0x26, 0xC1, 0x29, 0xC0, 0x2C, 0xC1, 0x2F, 0xC0, 0x32, 0xC1, 0x35, 0xC0, 0x38, 0xC1, 0x3B,
+    0xC0, 0x3E, 0xC1, 0x01, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x0B, 0xC1, 0x0E, 0xC0, 0x11, 0xC1, 0x14, 0xC0, 0x17, 0xC1, 0x1A,
+    0xC0, 0x1D, 0xC1, 0x20, 0xC0, 0x23, 0xC1, 0x26, 0xC0, 0x29, 0xC1, 0x2C, 0xC0, 0x2F, 0xC1, 0x32,
+    0xC0, 0x35, 0xC1, 0x38, 0xC0, 0x3B, 0xC1, 0x3E, 0xC0, 0x01, 0xC1, 0x04, 0xC0, 0x07, 0xC1, 0x0A,
+    0xC0, 0x0D, 0xC1, 0x10, 0xC0, 0x13, 0xC1, 0x16, 0xC0, 0x19, 0xC1, 0x1C, 0xC0, 0x1F, 0xC1, 0x22,
+    0xC0, 0x25, 0xC1, 0x28, 0xC0, 0x2B, 0xC1, 0x2E, 0xC0, 0x31, 0xC1, 0x34, 0xC0, 0x37, 0xC1, 0x3A,
+    0xC0, 0x3D, 0xC1, 0x00, 0xC0, 0x03, 0xC1, 0x06, 0xC0, 0x09, 0xC1, 0x0C, 0xC0, 0x0F, 0xC1, 0x12,
+    0xC0, 0x15, 0xC1, 0x18, 0xC0, 0x1B, 0xC1, 0x1E, 0xC0, 0x21, 0xC1, 0x24, 0xC0, 0x27, 0xC1, 0x2A,
+    0xC0, 0x2D, 0xC1, 0x30, 0xC0, 0x33, 0xC1, 0x36, 0xC0, 0x39, 0xC1, 0x3C, 0xC0, 0x3F, 0xC1, 0x02,
+    0xC0, 0x05, 0xC1, 0x08, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x12, 0xC1, 0x15, 0xC0, 0x18, 0xC1, 0x1B, 0xC0, 0x1E, 0xC1, 0x21,
+    0xC0, 0x24, 0xC1, 0x27, 0xC0, 0x2A, 0xC1, 0x2D, 0xC0, 0x30, 0xC1, 0x33, 0xC0, 0x36, 0xC1, 0x39,
+    0xC0, 0x3C, 0xC1, 0x3F, 0xC0, 0x02, 0xC1, 0x05, 0xC0, 0x08, 0xC1, 0x0B, 0xC0, 0x0E, 0xC1, 0x11,
+    0xC0, 0x14, 0xC1, 0x17, 0xC0, 0x1A, 0xC1, 0x1D, 0xC0, 0x20, 0xC1, 0x23, 0xC0, 0x26, 0xC1, 0x29,
+    0xC0, 0x2C, 0xC1, 0x2F, 0xC0, 0x32, 0xC1, 0x35, 0xC0, 0x38, 0xC1, 0x3B, 0xC0, 0x3E, 0xC1, 0x01,
+    0xC0, 0x04, 0xC1, 0x07, 0xC0, 0x0A, 0xC1, 0x0D, 0xC0, 0x10, 0xC1, 0x13, 0xC0, 0x16, 0xC1, 0x19,
+    0xC0, 0x1C, 0xC1, 0x1F, 0xC0, 0x22, 0xC1, 0x25, 0xC0, 0x28, 0xC1, 0x2B, 0xC0, 0x2E, 0xC1, 0x31,
+    0xC0, 0x34, 0xC1, 0x37, 0xC0, 0x3A, 0xC1, 0x3D, 0xC0, 0x00, 0xC1, 0x03, 0xC0, 0x06, 0xC1, 0x09,
+    0xC0, 0x0C, 0xC1, 0x0F, 0xC0, 0x7B, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x7A, 0xC1, 0x7A,
+    0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x19, 0xC1, 0x1C, 0xC0, 0x1F, 0xC1, 0x22, 0xC0, 0x25, 0xC1, 0x28,
+    0xC0, 0x2B, 0xC1, 0x2E, 0xC0, 0x31, 0xC1, 0x34, 0xC0, 0x37, 0xC1, 0x3A, 0xC0, 0x3D, 0xC1, 0x00,
+    0xC0, 0x03, 0xC1, 0x06, 0xC0, 0x09, 0xC1, 0x0C, 0xC0, 0x0F, 0xC1, 0x12, 0xC0, 0x15, 0xC1, 0x18,
+    0xC0, 0x1B, 0xC1, 0x1E, 0xC0, 0x21, 0xC1, 0x24, 0xC0, 0x27, 0xC1, 0x2A, 0xC0, 0x2D, 0xC1, 0x30,
+    0xC0, 0x33, 0xC1, 0x36, 0xC0, 0x39, 0xC1, 0x3C, 0xC0, 0x3F, 0xC1, 0x02, 0xC0, 0x05, 0xC1, 0x08,
+    0xC0, 0x0B, 0xC1, 0x0E, 0xC0, 0x11, 0xC1, 0x14, 0xC0, 0x17, 0xC1, 0x1A, 0xC0, 0x1D, 0xC1, 0x20,
+    0xC0, 0x23, 0xC1, 0x26, 0xC0, 0x29, 0xC1, 0x2C, 0xC0, 0x2F, 0xC1, 0x32, 0xC0, 0x35, 0xC1, 0x38,
+    0xC0, 0x3B, 0xC1, 0x3E, 0xC0, 0x01, 0xC1, 0x04, 0xC0, 0x07, 0xC1, 0x0A, 0xC0, 0x0D, 0xC1, 0x10,
+    0xC0, 0x13, 0xC1, 0x16, 0xC0,
+};
+
+} // namespace assets
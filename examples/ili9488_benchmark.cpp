@@ -0,0 +1,1490 @@
+/**
+ * @file ili9488_benchmark.cpp
+ * @brief ILI9488驱动性能基准测试程序
+ * @author usb2ttl_pico项目
+ * @version 1.0.0
+ *
+ * 功能说明：
+ * - 在真实硬件上测量ILI9488驱动各条绘制路径的吞吐量
+ * - 结果通过USB串口输出，便于在修改前后对比
+ * - 填充和文本测试只使用驱动的基础接口，可以直接拿到旧版本上编译对比
+ * - 每项测试的内容和接线要求见对应测试函数的注释
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+#include "hardware/spi.h"
+#include "hardware/regs/addressmap.h"
+
+// 项目头文件
+#include "text_editor.hpp"
+#include "ili9488_display_adapter.hpp"
+
+// ILI9488驱动头文件
+#include "ili9488_driver.hpp"
+#include "ili9488_colors.hpp"
+#include "ili9488_fixed_math.hpp"
+#include "ili9488_font.hpp"
+#include "pico_ili9488_band.hpp"
+#include "pico_ili9488_widgets.hpp"
+#include "polygon_raster.hpp"
+#include "display_list.hpp"
+#include "pico_ili9488_display_list.hpp"
+#include "pico_ili9488_sprites.hpp"
+#include "ili9488_image.hpp"
+#include "pin_config.hpp"
+
+// tools/img_pack.py生成的测试卡（160x120）
+#include "assets/test_card_rgb666.hpp"
+#include "assets/test_card_pal4.hpp"
+
+using namespace ili9488;
+using namespace ili9488_colors;
+using namespace usb2ttl;  // 使用项目命名空间
+using HardwareConfig = pin_config::ILI9488Config;  // 使用统一配置
+
+namespace {
+
+/**
+ * @brief 打印一项测试结果
+ * @param name 测试名称
+ * @param ops 完成的操作次数
+ * @param bytes 发送到屏幕的像素字节数
+ * @param elapsed_us 总耗时（微秒）
+ */
+void report(const char* name, uint32_t ops, uint64_t bytes, uint64_t elapsed_us) {
+    if (elapsed_us == 0) elapsed_us = 1;
+    float ops_per_sec = ops * 1000000.0f / elapsed_us;
+    float kbytes_per_sec = bytes * 1000000.0f / elapsed_us / 1024.0f;
+    printf("  %-28s %8.2f ops/s  %9.1f KB/s  (%lu ops, %llu us)\n",
+           name, ops_per_sec, kbytes_per_sec,
+           static_cast<unsigned long>(ops), static_cast<unsigned long long>(elapsed_us));
+}
+
+/**
+ * @brief 区域填充测试：交替填充两种颜色，统计每秒填充次数与字节速率
+ */
+void bench_fill(ILI9488Driver& lcd, const char* name,
+                uint16_t w, uint16_t h, uint32_t color_a, uint32_t color_b, uint32_t iterations) {
+    uint64_t start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        lcd.fillAreaRGB666(0, 0, w - 1, h - 1, (i & 1) ? color_b : color_a);
+    }
+    lcd.waitDMAComplete();
+    uint64_t elapsed = time_us_64() - start;
+
+    report(name, iterations, uint64_t(w) * h * 3 * iterations, elapsed);
+}
+
+/**
+ * @brief 文本绘制测试：统计每秒绘制的字符数
+ */
+void bench_text(ILI9488Driver& lcd, uint32_t iterations) {
+    const char* line = "The quick brown fox jumps over the dog";  // 38字符，编辑器满行
+    constexpr uint32_t line_chars = 38;
+    uint32_t fg = rgb888::WHITE;
+    uint32_t bg = rgb888::BLACK;
+
+    uint64_t start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        lcd.drawString(5, 5 + (i % 28) * 16, line, fg, bg);
+    }
+    uint64_t elapsed = time_us_64() - start;
+    report("drawString 38 chars", iterations * line_chars,
+           uint64_t(iterations) * line_chars * 8 * 16 * 3, elapsed);
+
+    start = time_us_64();
+    for (uint32_t i = 0; i < iterations * line_chars; ++i) {
+        lcd.drawChar(5 + (i % line_chars) * 8, 5, static_cast<char>('A' + i % 26), fg, bg);
+    }
+    elapsed = time_us_64() - start;
+    report("drawChar", iterations * line_chars,
+           uint64_t(iterations) * line_chars * 8 * 16 * 3, elapsed);
+}
+
+/**
+ * @brief 打印总线统计（命令数、CS切换次数、字节数、窗口缓存命中）
+ */
+void report_bus(const char* name, const BusStats& stats, uint64_t elapsed_us) {
+    printf("  %-28s cmds=%lu cs=%lu bytes=%lu win_sent=%lu win_skipped=%lu (%llu us)\n",
+           name,
+           static_cast<unsigned long>(stats.commands),
+           static_cast<unsigned long>(stats.cs_toggles),
+           static_cast<unsigned long>(stats.bytes),
+           static_cast<unsigned long>(stats.window_updates),
+           static_cast<unsigned long>(stats.window_skips),
+           static_cast<unsigned long long>(elapsed_us));
+}
+
+/**
+ * @brief 计时一个测试用例：清零总线统计，执行iterations次draw(i)，
+ *        等待DMA完成后打印速率与总线统计
+ * @param bytes_per_op 每次操作的像素字节数；为0时按总线实际发送的字节数统计
+ */
+template<typename Draw>
+void time_case(ILI9488Driver& lcd, const char* name, uint32_t iterations, Draw&& draw,
+               uint64_t bytes_per_op = 0) {
+    lcd.resetBusStats();
+    uint64_t start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        draw(i);
+    }
+    lcd.waitDMAComplete();
+    uint64_t elapsed = time_us_64() - start;
+    const BusStats& stats = lcd.getBusStats();
+    report(name, iterations, bytes_per_op ? bytes_per_op * iterations : stats.bytes, elapsed);
+    report_bus(name, stats, elapsed);
+}
+
+/**
+ * @brief 编辑器负载：模拟输入两行文本、换行和退格，统计总线开销
+ */
+void bench_editor(const std::shared_ptr<ILI9488DisplayAdapter>& display) {
+    TextEditor editor(display);
+    editor.initialize();
+
+    ILI9488Driver& lcd = display->getDriver();
+    const char* text = "Hello from the TTL keyboard editor!";
+
+    lcd.resetBusStats();
+    uint64_t start = time_us_64();
+    for (const char* p = text; *p; ++p) {
+        editor.insert_char(*p);
+    }
+    lcd.waitDMAComplete();
+    report_bus("type 35 chars", lcd.getBusStats(), time_us_64() - start);
+
+    lcd.resetBusStats();
+    start = time_us_64();
+    editor.newline();
+    for (int i = 0; i < 10; ++i) {
+        editor.backspace();
+    }
+    lcd.waitDMAComplete();
+    report_bus("newline + 10 backspaces", lcd.getBusStats(), time_us_64() - start);
+
+    // 填满可见行后再换行一次：硬件滚动只需VSCRSADD加重绘新露出的一行
+    while (editor.get_cursor_position().first < display->get_max_text_rows() - 1) {
+        editor.newline();
+    }
+    lcd.waitDMAComplete();
+    lcd.resetBusStats();
+    start = time_us_64();
+    editor.newline();
+    lcd.waitDMAComplete();
+    report_bus("newline at bottom (scroll)", lcd.getBusStats(), time_us_64() - start);
+
+    lcd.resetBusStats();
+    start = time_us_64();
+    editor.clear_screen();
+    lcd.waitDMAComplete();
+    report_bus("clear_screen", lcd.getBusStats(), time_us_64() - start);
+}
+
+/**
+ * @brief 颜色转换测试：只测CPU批量转换，再测RGB565/RGB888整行推送
+ */
+void bench_convert(ILI9488Driver& lcd, uint32_t iterations) {
+    constexpr size_t LINE = 320;
+    static uint16_t line565[LINE];
+    static uint32_t line888[LINE];
+    static uint8_t wire[LINE * 3];
+    for (size_t i = 0; i < LINE; ++i) {
+        line888[i] = color888(uint8_t(i), uint8_t(i * 3), uint8_t(255 - i));
+        line565[i] = rgb888_to_rgb565(line888[i]);
+    }
+
+    uint64_t start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        rgb565_to_rgb666_bytes(line565, wire, LINE);
+    }
+    report("convert 565->666 (320 px)", iterations, uint64_t(iterations) * LINE * 3,
+           time_us_64() - start);
+
+    start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        rgb888_to_rgb666_bytes(line888, wire, LINE);
+    }
+    report("convert 888->666 (320 px)", iterations, uint64_t(iterations) * LINE * 3,
+           time_us_64() - start);
+
+    start = time_us_64();
+    for (uint32_t y = 0; y < 480; ++y) {
+        lcd.writePixels(0, y, LINE - 1, y, line565, LINE);
+    }
+    report("writePixels 320x480", 480, uint64_t(480) * LINE * 3, time_us_64() - start);
+
+    start = time_us_64();
+    for (uint32_t y = 0; y < 480; ++y) {
+        lcd.writePixelsRGB24(0, y, LINE - 1, y, line888, LINE);
+    }
+    report("writePixelsRGB24 320x480", 480, uint64_t(480) * LINE * 3, time_us_64() - start);
+
+    start = time_us_64();
+    for (uint32_t i = 0; i < 10; ++i) {
+        lcd.fillScreenRGB24((i & 1) ? rgb888::NAVY : rgb888::ORANGE);
+    }
+    lcd.waitDMAComplete();
+    report("fillScreenRGB24 navy/orange", 10, uint64_t(320) * 480 * 3 * 10, time_us_64() - start);
+}
+
+/**
+ * @brief 像素推送测试：64x64位图与分条整屏推送（对比乒乓DMA流水线前后）
+ */
+void bench_push(ILI9488Driver& lcd) {
+    constexpr uint16_t TILE = 64;
+    constexpr uint16_t STRIP_W = 320;
+    constexpr uint16_t STRIP_H = 48;
+    static uint16_t tile[TILE * TILE];
+    static uint16_t strip[STRIP_W * STRIP_H];
+    for (size_t i = 0; i < TILE * TILE; ++i) {
+        tile[i] = rgb888_to_rgb565(color888(uint8_t(i * 4), uint8_t(i / 16), 0x80));
+    }
+    for (size_t i = 0; i < size_t(STRIP_W) * STRIP_H; ++i) {
+        strip[i] = rgb888_to_rgb565(color888(uint8_t(i), uint8_t(i >> 8), uint8_t(i >> 4)));
+    }
+
+    constexpr uint32_t tiles = 100;
+    uint64_t start = time_us_64();
+    for (uint32_t i = 0; i < tiles; ++i) {
+        uint16_t x = (i % 5) * TILE;
+        uint16_t y = ((i / 5) % 7) * TILE;
+        lcd.writePixels(x, y, x + TILE - 1, y + TILE - 1, tile, TILE * TILE);
+    }
+    lcd.waitDMAComplete();
+    report("bitmap 64x64", tiles, uint64_t(tiles) * TILE * TILE * 3, time_us_64() - start);
+
+    constexpr uint32_t frames = 5;
+    start = time_us_64();
+    for (uint32_t f = 0; f < frames; ++f) {
+        for (uint16_t y = 0; y < 480; y += STRIP_H) {
+            lcd.writePixels(0, y, STRIP_W - 1, y + STRIP_H - 1, strip, size_t(STRIP_W) * STRIP_H);
+        }
+    }
+    lcd.waitDMAComplete();
+    report("full screen 320x48 strips", frames, uint64_t(frames) * 320 * 480 * 3,
+           time_us_64() - start);
+}
+
+/**
+ * @brief TE同步测试：测量面板刷新周期，并统计推迟到消隐期启动的传输数
+ * @details 需要将面板TE引脚接到PIN_TE（GPIO 21），未接时只打印提示
+ */
+void bench_tearing(ILI9488Driver& lcd) {
+    if (!lcd.enableTearingSync(HardwareConfig::pin_te)) {
+        printf("  TE sync unavailable (no DMA channel)\n");
+        return;
+    }
+    sleep_ms(100);  // 等待几个TE边沿以测得刷新周期
+
+    TearingStats te = lcd.getTearingStats();
+    if (te.frames == 0) {
+        printf("  No TE edges on GPIO %u, is the TE pin connected?\n", HardwareConfig::pin_te);
+    } else {
+        printf("  refresh period %lu us (%.1f Hz)\n",
+               static_cast<unsigned long>(te.period_us),
+               te.period_us ? 1000000.0f / te.period_us : 0.0f);
+    }
+
+    // 调用立即返回，传输在消隐期由TE中断启动
+    uint64_t start = time_us_64();
+    for (uint32_t i = 0; i < 10; ++i) {
+        lcd.fillAreaRGB666(0, 0, 319, 479, (i & 1) ? rgb666::BLUE : rgb666::RED);
+    }
+    uint64_t queued = time_us_64() - start;
+    lcd.waitDMAComplete();
+    report("TE-synced full screen", 10, uint64_t(320) * 480 * 3 * 10, time_us_64() - start);
+    printf("  issuing the fills took %llu us, deferred transfers: %lu\n",
+           static_cast<unsigned long long>(queued),
+           static_cast<unsigned long>(lcd.getTearingStats().deferred));
+
+    lcd.disableTearingSync();
+}
+
+/**
+ * @brief 3位色模式测试：同一屏文本在RGB666与RGB111下的字节数和耗时对比
+ */
+void bench_color_mode(ILI9488Driver& lcd) {
+    const char* line = "The quick brown fox jumps over the dog";
+    const ColorMode modes[] = {ColorMode::RGB666, ColorMode::RGB111};
+    const char* names[] = {"text screen RGB666", "text screen RGB111"};
+
+    for (int m = 0; m < 2; ++m) {
+        lcd.setColorMode(modes[m]);
+        lcd.fillScreenRGB666(rgb666::BLACK);
+        lcd.waitDMAComplete();
+
+        lcd.resetBusStats();
+        uint64_t start = time_us_64();
+        for (uint16_t row = 0; row < 28; ++row) {
+            lcd.drawString(5, 5 + row * 16, line, rgb888::GREEN, rgb888::BLACK);
+        }
+        report_bus(names[m], lcd.getBusStats(), time_us_64() - start);
+    }
+
+    lcd.setColorMode(ColorMode::RGB666);
+    lcd.fillScreenRGB666(rgb666::BLACK);
+}
+
+/**
+ * @brief 打印一帧帧缓冲统计（立即模式字节数、实际发送字节数、节省比例）
+ */
+void report_frame(const char* name, const ILI9488Framebuffer::FlushStats& stats, uint64_t elapsed_us) {
+    uint32_t saved = stats.bytes_drawn > stats.bytes_sent ? stats.bytes_drawn - stats.bytes_sent : 0;
+    printf("  %-28s drawn=%lu sent=%lu saved=%lu (%.0f%%) tiles=%lu win=%lu (%llu us)\n",
+           name,
+           static_cast<unsigned long>(stats.bytes_drawn),
+           static_cast<unsigned long>(stats.bytes_sent),
+           static_cast<unsigned long>(saved),
+           stats.bytes_drawn ? saved * 100.0f / stats.bytes_drawn : 0.0f,
+           static_cast<unsigned long>(stats.tiles_sent),
+           static_cast<unsigned long>(stats.windows),
+           static_cast<unsigned long long>(elapsed_us));
+}
+
+/**
+ * @brief 帧缓冲测试：编辑器按键与状态栏刷新，每次refresh()视为一帧
+ */
+void bench_framebuffer(const std::shared_ptr<ILI9488DisplayAdapter>& display) {
+    display->enable_framebuffer(true);
+    TextEditor editor(display);
+    editor.clear_screen();
+    display->refresh();
+
+    // 编辑器：每个按键一帧
+    ILI9488Framebuffer::FlushStats total;
+    uint64_t start = time_us_64();
+    const char* text = "Hello from the TTL keyboard editor!";
+    for (const char* p = text; *p; ++p) {
+        editor.insert_char(*p);
+        display->refresh();
+        const auto& frame = display->get_last_flush_stats();
+        total.bytes_drawn += frame.bytes_drawn;
+        total.bytes_sent += frame.bytes_sent;
+        total.tiles_sent += frame.tiles_sent;
+        total.windows += frame.windows;
+    }
+    display->getDriver().waitDMAComplete();
+    report_frame("type 35 chars (sum)", total, time_us_64() - start);
+
+    // 状态栏：与演示程序相同的先清除后绘制，内容不变时不产生流量
+    int status_y = display->get_height() - ILI9488DisplayAdapter::STATUS_BAR_HEIGHT;
+    for (int frame = 0; frame < 2; ++frame) {
+        start = time_us_64();
+        display->fill_rect(0, status_y, display->get_width(), 30, rgb666::BLACK);
+        display->draw_text("TTL-KB: Connected", 10, status_y, rgb666::GREEN, rgb666::BLACK);
+        display->draw_text("EDIT", 200, status_y, rgb666::YELLOW, rgb666::BLACK);
+        display->draw_text("Row: 1, Col: 35", 10, status_y + 15, rgb666::WHITE, rgb666::BLACK);
+        display->refresh();
+        display->getDriver().waitDMAComplete();
+        report_frame(frame == 0 ? "status bar (first)" : "status bar (unchanged)",
+                     display->get_last_flush_stats(), time_us_64() - start);
+    }
+
+    display->enable_framebuffer(false);
+}
+
+
+/**
+ * @brief 命令界面中的一行文本
+ */
+struct SceneText {
+    const char* text;
+    int16_t x;
+    int16_t y;
+    uint32_t color;
+};
+
+/**
+ * @brief 与演示程序show_command_screen()相同布局的文本
+ */
+const SceneText kCommandScreen[] = {
+    {"KEYBOARD COMMANDS", 70, 15, rgb666::YELLOW},
+    {"=================", 70, 35, rgb666::CYAN},
+    {"Enter", 20, 70, rgb666::GREEN},   {"-", 120, 70, rgb666::YELLOW},  {"Enter text edit mode", 140, 70, rgb666::WHITE},
+    {"ESC", 20, 95, rgb666::WHITE},     {"-", 120, 95, rgb666::YELLOW},  {"Clear screen & reset", 140, 95, rgb666::WHITE},
+    {"F10", 20, 120, rgb666::GREEN},    {"-", 120, 120, rgb666::YELLOW}, {"Save current text", 140, 120, rgb666::WHITE},
+    {"Backspace", 20, 145, rgb666::WHITE}, {"-", 120, 145, rgb666::YELLOW}, {"Delete character", 140, 145, rgb666::WHITE},
+    {"Tab", 20, 170, rgb666::WHITE},    {"-", 120, 170, rgb666::YELLOW}, {"Insert 4 spaces", 140, 170, rgb666::WHITE},
+    {"System Status:", 20, 230, rgb666::CYAN},
+    {"TTL UART: Ready", 20, 250, rgb666::GREEN},
+    {"Display: ILI9488 RGB666", 20, 270, rgb666::GREEN},
+    {"Text Editor: Ready", 20, 290, rgb666::GREEN},
+};
+
+/**
+ * @brief 分条渲染测试：命令界面逐条绘制与按16行分条推送的耗时和总线开销
+ */
+void bench_band(const std::shared_ptr<ILI9488DisplayAdapter>& display, uint32_t iterations) {
+    ILI9488Driver& lcd = display->getDriver();
+    const int16_t w = display->get_width();
+    const int16_t h = display->get_height();
+
+    // 立即模式：清屏、两个边框、逐串绘制文本
+    lcd.resetBusStats();
+    uint64_t start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        display->clear_screen(rgb666::BLACK);
+        display->draw_rect(5, 5, w - 10, h - 10, rgb666::CYAN);
+        display->draw_rect(10, 220, w - 20, 120, rgb666::BLUE);
+        for (const auto& t : kCommandScreen) {
+            display->draw_text(t.text, t.x, t.y, t.color, rgb666::BLACK);
+        }
+    }
+    lcd.waitDMAComplete();
+    report_bus("command screen (immediate)", lcd.getBusStats(), time_us_64() - start);
+
+    // 分条模式：同一场景在每条中重放，每条只开一个窗口
+    pico_ili9488_gfx::PicoILI9488BandRenderer<ILI9488Driver> band(lcd, 16);
+    band.setBackground(rgb888_to_rgb565(rgb666::BLACK));
+    auto scene = [&](ili9488::ILI9488_UI& ui) {
+        ui.drawRect(5, 5, w - 10, h - 10, rgb888_to_rgb565(rgb666::CYAN));
+        ui.drawRect(10, 220, w - 20, 120, rgb888_to_rgb565(rgb666::BLUE));
+        for (const auto& t : kCommandScreen) {
+            band.drawText(t.x, t.y, t.text, rgb888_to_rgb565(t.color), 0x0000);
+        }
+    };
+
+    lcd.resetBusStats();
+    start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        band.render(scene);
+    }
+    lcd.waitDMAComplete();
+    report_bus("command screen (bands)", lcd.getBusStats(), time_us_64() - start);
+}
+
+
+/**
+ * @brief 字形缓存测试：同一组文本分别在关闭和启用缓存时绘制，输出命中率与内存占用
+ */
+void bench_glyph_cache(ILI9488Driver& lcd, uint32_t iterations) {
+    const char* lines[] = {
+        "TTL-KB: Connected   EDIT",
+        "Row: 12, Col: 35",
+        "The quick brown fox jumps over the dog",
+    };
+    constexpr uint32_t line_count = sizeof(lines) / sizeof(lines[0]);
+    uint32_t colors[line_count] = {rgb888::GREEN, rgb888::WHITE, rgb888::YELLOW};
+
+    // 每次操作绘制一行（drawString）或一个字符（drawChar）
+    auto run = [&](const char* name) {
+        time_case(lcd, name, iterations * line_count, [&](uint32_t i) {
+            uint32_t l = i % line_count;
+            lcd.drawString(5, 5 + l * 16, lines[l], colors[l], rgb888::BLACK);
+        });
+        time_case(lcd, "  drawChar", iterations * 20, [&](uint32_t i) {
+            lcd.drawChar(5 + (i % 20) * 8, 60, static_cast<char>('0' + i % 10),
+                         rgb888::WHITE, rgb888::BLACK);
+        }, 8 * 16 * 3);
+    };
+
+    lcd.fillScreenRGB666(rgb666::BLACK);
+    lcd.disableGlyphCache();
+    run("drawString uncached");
+
+    lcd.enableGlyphCache(16 * 1024);
+    run("drawString cached");
+    GlyphCacheStats stats = lcd.getGlyphCacheStats();
+    printf("  hit rate %.1f%%  hits=%lu misses=%lu evictions=%lu  %lu/%lu glyphs, %lu bytes\n",
+           stats.hitRate() * 100.0f,
+           static_cast<unsigned long>(stats.hits),
+           static_cast<unsigned long>(stats.misses),
+           static_cast<unsigned long>(stats.evictions),
+           static_cast<unsigned long>(stats.entries),
+           static_cast<unsigned long>(stats.capacity),
+           static_cast<unsigned long>(stats.bytes));
+}
+
+
+/**
+ * @brief 图元测试：通过GFX层绘制填充图元和轮廓，统计每秒图元数
+ */
+void bench_primitives(ILI9488DisplayAdapter::GFX& gfx, uint32_t iterations) {
+    const uint16_t colors[] = {
+        rgb888_to_rgb565(rgb888::RED), rgb888_to_rgb565(rgb888::GREEN),
+        rgb888_to_rgb565(rgb888::BLUE), rgb888_to_rgb565(rgb888::YELLOW),
+    };
+    ILI9488Driver& lcd = gfx.getDriver();
+
+    lcd.fillScreenRGB666(rgb666::BLACK);
+    time_case(lcd, "fillRect 60x40", iterations, [&](uint32_t i) {
+        gfx.fillRect(10 + (i % 4) * 70, 10 + (i % 10) * 45, 60, 40, colors[i & 3]);
+    });
+    time_case(lcd, "drawRect 60x40", iterations, [&](uint32_t i) {
+        gfx.drawRect(10 + (i % 4) * 70, 10 + (i % 10) * 45, 60, 40, colors[i & 3]);
+    });
+    time_case(lcd, "fillCircle r=30", iterations, [&](uint32_t i) {
+        gfx.fillCircle(40 + (i % 4) * 75, 40 + (i % 6) * 75, 30, colors[i & 3]);
+    });
+    time_case(lcd, "fillRoundRect 80x50 r=10", iterations, [&](uint32_t i) {
+        gfx.fillRoundRect(10 + (i % 3) * 100, 10 + (i % 8) * 55, 80, 50, 10, colors[i & 3]);
+    });
+    time_case(lcd, "fillTriangle 60px", iterations, [&](uint32_t i) {
+        int16_t x = 10 + (i % 4) * 75;
+        int16_t y = 10 + (i % 7) * 65;
+        gfx.fillTriangle(x, y + 60, x + 30, y, x + 60, y + 60, colors[i & 3]);
+    });
+    time_case(lcd, "drawLine diagonal 200px", iterations, [&](uint32_t i) {
+        gfx.drawLine(10, 10 + (i % 200), 210, 210 - (i % 200), colors[i & 3]);
+    });
+}
+
+
+/**
+ * @brief 位图测试：整屏位图、部分移出屏幕的裁剪位图与64x64图标
+ * @details 320x480 RGB565位图需要300KB，超过片上RAM，
+ * 直接把XIP映射的Flash当作位图数据（图标通常也存放在Flash中）
+ */
+void bench_bitmap(ILI9488DisplayAdapter::GFX& gfx, uint32_t iterations) {
+    const auto* flash = reinterpret_cast<const uint16_t*>(XIP_BASE);
+    ILI9488Driver& lcd = gfx.getDriver();
+    printf("  DMA=%d partial area API=%d\n",
+           gfx.supportsDMA(), gfx.supportsPartialRefresh());
+
+    uint64_t start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        gfx.drawBitmapFast(0, 0, 320, 480, flash + i * 320);
+    }
+    lcd.waitDMAComplete();
+    report("bitmap 320x480", iterations, uint64_t(320) * 480 * 3 * iterations, time_us_64() - start);
+
+    // 左上各移出100像素，可见部分220x380仍为单窗口
+    start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        gfx.drawBitmapFast(-100, -100, 320, 480, flash);
+    }
+    lcd.waitDMAComplete();
+    report("bitmap clipped 220x380", iterations, uint64_t(220) * 380 * 3 * iterations, time_us_64() - start);
+
+    // 图标：快速路径与基类逐像素路径对比
+    uint32_t icons = iterations * 20;
+    start = time_us_64();
+    for (uint32_t i = 0; i < icons; ++i) {
+        gfx.drawBitmapFast((i % 5) * 64, (i % 7) * 64, 64, 64, flash + i * 64);
+    }
+    lcd.waitDMAComplete();
+    report("icon 64x64 fast", icons, uint64_t(64) * 64 * 3 * icons, time_us_64() - start);
+
+    start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        gfx.drawBitmap((i % 5) * 64, (i % 7) * 64, 64, 64, flash + i * 64);
+    }
+    lcd.waitDMAComplete();
+    report("icon 64x64 per-pixel", iterations, uint64_t(64) * 64 * 3 * iterations, time_us_64() - start);
+}
+
+
+/**
+ * @brief 黄金测试用的内存驱动：GFX层的输出写入RAM中的RGB565帧
+ * @details 只实现PicoILI9488GFX用到的接口，校验值与面板、总线和MISO接线无关
+ */
+struct CaptureDriver {
+    static constexpr uint16_t SIZE = 128;
+    std::vector<uint16_t> pixels = std::vector<uint16_t>(SIZE * SIZE, 0);
+
+    void drawPixel(uint16_t x, uint16_t y, uint16_t color) {
+        if (x < SIZE && y < SIZE) pixels[y * SIZE + x] = color;
+    }
+    void drawPixelRGB24(uint16_t x, uint16_t y, uint32_t color) {
+        drawPixel(x, y, rgb888_to_rgb565(color));
+    }
+    void fillArea(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
+        for (uint16_t y = y0; y <= y1; ++y) {
+            for (uint16_t x = x0; x <= x1; ++x) drawPixel(x, y, color);
+        }
+    }
+    void writePixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                     const uint16_t* colors, size_t count) {
+        for (uint16_t y = y0; y <= y1; ++y) {
+            for (uint16_t x = x0; x <= x1 && count > 0; ++x, --count) drawPixel(x, y, *colors++);
+        }
+    }
+
+    /// 清屏并返回绘制后整帧的FNV-1a（每像素先低字节后高字节）
+    template<typename Draw>
+    uint32_t hash(Draw&& draw) {
+        std::fill(pixels.begin(), pixels.end(), 0);
+        draw();
+        uint32_t h = 0x811C9DC5u;
+        for (uint16_t c : pixels) {
+            h = (h ^ (c & 0xFF)) * 0x01000193u;
+            h = (h ^ (c >> 8)) * 0x01000193u;
+        }
+        return h;
+    }
+};
+
+/**
+ * @brief 抗锯齿黄金测试：在128x128内存帧上绘制，校验值与预期一致即PASS
+ * @details 线段端点超出帧边界以覆盖逐像素裁剪路径；大圆半径256到576，
+ *          圆心在帧外，圆弧穿过帧内，覆盖8.8定点的根超过16位的情形
+ */
+void check_antialias_golden() {
+    CaptureDriver capture;
+    pico_ili9488_gfx::PicoILI9488GFX<CaptureDriver> gfx(capture, CaptureDriver::SIZE, CaptureDriver::SIZE);
+    const uint16_t color = rgb888_to_rgb565(rgb888::ORANGE);
+    gfx.setBlendBackground(rgb888_to_rgb565(rgb888::NAVY));
+
+    const struct {
+        const char* name;
+        uint32_t expected;
+        uint32_t hash;
+    } cases[] = {
+        {"golden drawLineAA fan", 0x44F516EBu, capture.hash([&] {
+            // 端点沿(-16,-16)-(143,143)的边移动，每边160个
+            for (int16_t t = 0; t < 160; ++t) {
+                gfx.drawLineAA(64, 64, -16 + t, -16, color);
+                gfx.drawLineAA(64, 64, 143, -16 + t, color);
+                gfx.drawLineAA(64, 64, 143 - t, 143, color);
+                gfx.drawLineAA(64, 64, -16, 143 - t, color);
+            }
+        })},
+        {"golden drawCircleAA r=1..60", 0x68F398A5u, capture.hash([&] {
+            for (int16_t r = 1; r <= 60; r += 3) {
+                gfx.drawCircleAA(64, 64, r, color);
+            }
+        })},
+        {"golden drawCircleAA r=256..576", 0x39AE8202u, capture.hash([&] {
+            for (int16_t k = 0; k <= 10; ++k) {
+                int16_t r = 256 + k * 32;
+                gfx.drawCircleAA(8 + k * 11 - r, 64 - k * 3, r, color);
+            }
+        })},
+    };
+    for (const auto& c : cases) {
+        printf("  %-30s %s (0x%08lX)\n", c.name, c.hash == c.expected ? "PASS" : "FAIL",
+               static_cast<unsigned long>(c.hash));
+    }
+}
+
+/**
+ * @brief 抗锯齿测试：扇形分布的线段和同心圆，普通与Wu抗锯齿版本对比
+ */
+void bench_antialias(ILI9488DisplayAdapter::GFX& gfx, uint32_t iterations) {
+    ILI9488Driver& lcd = gfx.getDriver();
+    uint16_t white = rgb888_to_rgb565(rgb888::WHITE);
+    gfx.setBlendBackground(0x0000);
+    lcd.fillScreenRGB666(rgb666::BLACK);
+
+    // 端点沿矩形边缘移动，覆盖所有斜率
+    auto endpoint = [](uint32_t i, int16_t& x, int16_t& y) {
+        uint32_t t = i % 600;
+        if (t < 150)      { x = 10 + t * 2;         y = 10; }
+        else if (t < 300) { x = 310;                y = 10 + (t - 150) * 3; }
+        else if (t < 450) { x = 310 - (t - 300) * 2; y = 460; }
+        else              { x = 10;                 y = 460 - (t - 450) * 3; }
+    };
+
+    time_case(lcd, "drawLine fan", iterations, [&](uint32_t i) {
+        int16_t x, y;
+        endpoint(i, x, y);
+        gfx.drawLine(160, 240, x, y, white);
+    });
+    time_case(lcd, "drawLineAA fan", iterations, [&](uint32_t i) {
+        int16_t x, y;
+        endpoint(i, x, y);
+        gfx.drawLineAA(160, 240, x, y, white);
+    });
+    time_case(lcd, "drawCircle r=10..150", iterations, [&](uint32_t i) {
+        gfx.drawCircle(160, 240, 10 + (i % 15) * 10, white);
+    });
+    time_case(lcd, "drawCircleAA r=10..150", iterations, [&](uint32_t i) {
+        gfx.drawCircleAA(160, 240, 10 + (i % 15) * 10, white);
+    });
+    // 大半径：8.8定点的根超过16位（r>=256），屏幕外的部分由裁剪丢弃
+    time_case(lcd, "drawCircle r=160..580", iterations, [&](uint32_t i) {
+        gfx.drawCircle(160, 240, 160 + (i % 22) * 20, white);
+    });
+    time_case(lcd, "drawCircleAA r=160..580", iterations, [&](uint32_t i) {
+        gfx.drawCircleAA(160, 240, 160 + (i % 22) * 20, white);
+    });
+
+    check_antialias_golden();
+}
+
+/**
+ * @brief 半透明测试：在编辑器文本上叠加200x60的半透明提示框
+ */
+void bench_alpha(ILI9488DisplayAdapter::GFX& gfx, uint32_t iterations) {
+    ILI9488Driver& lcd = gfx.getDriver();
+    constexpr int16_t toast_x = 60, toast_y = 200, toast_w = 200, toast_h = 60;
+    uint16_t blue = rgb888_to_rgb565(rgb888::BLUE);
+
+    auto draw_background = [&]() {
+        lcd.fillScreenRGB666(rgb666::BLACK);
+        for (int16_t y = 5; y < 460; y += 16) {
+            lcd.drawString(5, y, "The quick brown fox jumps over the dog", rgb888::WHITE, rgb888::BLACK);
+        }
+        lcd.waitDMAComplete();
+    };
+
+    auto toast = [&](uint32_t) {
+        gfx.fillRectAlpha(toast_x, toast_y, toast_w, toast_h, blue, 96);
+    };
+    const uint64_t toast_bytes = uint64_t(toast_w) * toast_h * 3;
+
+    // 影子缓冲：从屏幕回读一次（未接MISO时为底色），之后全部在内存中合成
+    draw_background();
+    std::unique_ptr<uint16_t[]> shadow(new uint16_t[toast_w * toast_h]);
+    if (!lcd.readPixels(toast_x, toast_y, toast_x + toast_w - 1, toast_y + toast_h - 1, shadow.get())) {
+        std::fill(shadow.get(), shadow.get() + toast_w * toast_h, 0x0000);
+    }
+    gfx.setShadowBuffer(shadow.get(), toast_x, toast_y, toast_w, toast_h);
+    time_case(lcd, "toast alpha (shadow)", iterations, toast, toast_bytes);
+    gfx.setShadowBuffer(nullptr, 0, 0, 0, 0);
+
+    draw_background();
+    if (lcd.isReadbackEnabled()) {
+        time_case(lcd, "toast alpha (RAMRD)", iterations, toast, toast_bytes);
+    } else {
+        printf("  toast alpha (RAMRD)          skipped (readback not enabled)\n");
+    }
+
+    // 逐像素路径：每个像素一次读-混合-写窗口
+    draw_background();
+    time_case(lcd, "toast drawPixelAlpha x12000", 1, [&](uint32_t) {
+        for (int16_t y = 0; y < toast_h; ++y) {
+            for (int16_t x = 0; x < toast_w; ++x) {
+                gfx.drawPixelAlpha(toast_x + x, toast_y + y, blue, 96);
+            }
+        }
+    }, toast_bytes);
+}
+
+/**
+ * @brief 渐变测试：整屏渐变的帧率，单色填充作为总线速度参考
+ */
+void bench_gradient(ILI9488DisplayAdapter::GFX& gfx, uint32_t iterations) {
+    ILI9488Driver& lcd = gfx.getDriver();
+    const uint64_t frame_bytes = uint64_t(320) * 480 * 3;
+
+    time_case(lcd, "fill red (reference)", iterations, [&](uint32_t) {
+        lcd.fillScreenRGB24(rgb888::RED);
+    }, frame_bytes);
+    time_case(lcd, "gradient horizontal", iterations, [&](uint32_t i) {
+        gfx.drawGradient(0, 0, 320, 480, (i & 1) ? rgb888::BLUE : rgb888::RED, rgb888::YELLOW, true);
+    }, frame_bytes);
+    time_case(lcd, "gradient vertical", iterations, [&](uint32_t i) {
+        gfx.drawGradient(0, 0, 320, 480, (i & 1) ? rgb888::BLUE : rgb888::RED, rgb888::YELLOW, false);
+    }, frame_bytes);
+    time_case(lcd, "gradient two-axis", iterations, [&](uint32_t i) {
+        gfx.drawGradient2D(0, 0, 320, 480, (i & 1) ? rgb888::BLACK : 0x202020,
+                           rgb888::RED, rgb888::BLUE);
+    }, frame_bytes);
+    time_case(lcd, "gradient clipped 200x100", iterations, [&](uint32_t) {
+        gfx.drawGradient(-100, 380, 300, 300, rgb888::GREEN, rgb888::BLUE, true);
+    }, uint64_t(200) * 100 * 3);
+}
+
+/**
+ * @brief 定点数学测试：浮点与Q15三角函数的速度、精度，以及仪表盘重绘速度
+ */
+void bench_fixed_math(ILI9488DisplayAdapter::GFX& gfx, uint32_t iterations) {
+    using namespace ili9488::fixed;
+    ILI9488Driver& lcd = gfx.getDriver();
+    constexpr float kTwoPi = 6.2831853f;
+    volatile int32_t sink = 0;  // 防止编译器优化掉循环
+
+    // 速度：每次迭代计算一对sin/cos
+    uint64_t start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        float angle = kTwoPi * float(i & 0xFFFF) / 65536.0f;
+        sink = sink + int32_t(sinf(angle) * 32767.0f) + int32_t(cosf(angle) * 32767.0f);
+    }
+    report("sinf+cosf (soft float)", iterations, 0, time_us_64() - start);
+
+    start = time_us_64();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        angle_t angle = static_cast<angle_t>(i * 40503u);
+        sink = sink + sin_q15(angle) + cos_q15(angle);
+    }
+    report("sin_q15+cos_q15 (LUT)", iterations, 0, time_us_64() - start);
+
+    // 精度：遍历全部65536个角度，以浮点结果为参考
+    int32_t max_error = 0;
+    for (uint32_t a = 0; a < 65536; ++a) {
+        int32_t expected = int32_t(lroundf(sinf(kTwoPi * float(a) / 65536.0f) * 32767.0f));
+        int32_t error = std::abs(sin_q15(static_cast<angle_t>(a)) - expected);
+        if (error > max_error) max_error = error;
+    }
+    printf("  %-30s %s (%ld LSB, limit 3)\n", "sin_q15 max error",
+           max_error <= 3 ? "PASS" : "FAIL", static_cast<long>(max_error));
+
+    // 仪表盘：浮点接口（换算为Q16后整数计算）与Q16接口
+    lcd.fillScreenRGB24(rgb888::BLACK);
+    // 先用背景色擦掉上一根指针，再画新指针
+    auto float_gauge = [&](uint32_t i, uint16_t color) {
+        gfx.drawGauge(160, 240, 100, float(i % 100), 0.0f, 99.0f, color, rgb565::WHITE);
+    };
+    time_case(lcd, "gauge float value", 200, [&](uint32_t i) {
+        float_gauge(i == 0 ? 0 : i - 1, rgb565::BLACK);
+        float_gauge(i, rgb565::GREEN);
+    });
+    auto q16_gauge = [&](uint32_t i, uint16_t color) {
+        gfx.drawGaugeFraction(160, 240, 100, fraction_q16(int32_t(i % 100), 0, 99),
+                              color, rgb565::WHITE);
+    };
+    time_case(lcd, "gauge Q16 fraction", 200, [&](uint32_t i) {
+        q16_gauge(i == 0 ? 0 : i - 1, rgb565::BLACK);
+        q16_gauge(i, rgb565::GREEN);
+    });
+}
+
+/**
+ * @brief 控件增量刷新测试：模拟遥测数据（每次小幅变化），对比整体重绘与增量刷新
+ */
+void bench_widgets(ILI9488DisplayAdapter::GFX& gfx, uint32_t iterations) {
+    using namespace pico_ili9488_gfx;
+    ILI9488Driver& lcd = gfx.getDriver();
+    lcd.fillScreenRGB24(rgb888::BLACK);
+
+    // 三角波：0→100→0，每次变化1
+    auto sample = [](uint32_t i) -> int32_t {
+        int32_t phase = int32_t(i % 200);
+        return phase <= 100 ? phase : 200 - phase;
+    };
+
+    time_case(lcd, "progress bar full redraw", iterations, [&](uint32_t i) {
+        gfx.drawProgressBar(10, 20, 300, 24, uint8_t(sample(i)), rgb565::GREEN, rgb565::DARKGREY);
+    });
+    PicoILI9488ProgressBar<ILI9488Driver> bar(gfx, 10, 20, 300, 24, rgb565::GREEN, rgb565::DARKGREY);
+    time_case(lcd, "progress bar delta", iterations, [&](uint32_t i) {
+        bar.update(uint8_t(sample(i)));
+    });
+
+    time_case(lcd, "gauge full redraw", iterations, [&](uint32_t i) {
+        gfx.fillCircle(160, 260, 100, rgb565::BLACK);
+        gfx.drawGaugeFraction(160, 260, 100, ili9488::fixed::fraction_q16(sample(i), 0, 100),
+                              rgb565::GREEN, rgb565::WHITE);
+    });
+    PicoILI9488Gauge<ILI9488Driver> gauge(gfx, 160, 260, 100,
+                                          rgb565::GREEN, rgb565::WHITE, rgb565::BLACK);
+    time_case(lcd, "gauge delta", iterations, [&](uint32_t i) {
+        gauge.update(sample(i));
+    });
+}
+
+/**
+ * @brief 文字特效测试：描边标题和阴影文字，对比逐次叠加绘制与掩码单窗口推送
+ */
+void bench_text_effects(ILI9488DisplayAdapter::GFX& gfx, uint32_t iterations) {
+    ILI9488Driver& lcd = gfx.getDriver();
+    const char* title = "USB2TTL Terminal";
+    lcd.fillScreenRGB24(rgb888::BLACK);
+
+    // 旧做法：8个方向各画一次描边色，再画一次正文
+    time_case(lcd, "outlined title 9x drawString", iterations, [&](uint32_t) {
+        for (int16_t dx = -1; dx <= 1; ++dx) {
+            for (int16_t dy = -1; dy <= 1; ++dy) {
+                if (dx != 0 || dy != 0) {
+                    gfx.drawString(40 + dx, 40 + dy, title, rgb565::BLUE, 0, 1);
+                }
+            }
+        }
+        gfx.drawString(40, 40, title, rgb565::WHITE, 0, 1);
+    });
+    time_case(lcd, "outlined title (mask)", iterations, [&](uint32_t) {
+        gfx.drawStringOutlined(40, 80, title, rgb565::WHITE, rgb565::BLUE);
+    });
+    time_case(lcd, "shadow title (mask)", iterations, [&](uint32_t) {
+        gfx.drawStringWithShadow(40, 120, title, rgb565::YELLOW, rgb565::DARKGREY, 2, 2);
+    });
+}
+
+/**
+ * @brief 裁剪测试：同一场景整屏重绘与只在状态栏裁剪区域内重绘
+ */
+void bench_clip(ILI9488DisplayAdapter::GFX& gfx, uint32_t iterations) {
+    ILI9488Driver& lcd = gfx.getDriver();
+    const int16_t w = gfx.width();
+    const int16_t h = gfx.height();
+
+    // 仪表界面：编辑区边框、若干控件和底部状态栏
+    auto scene = [&](uint32_t i) {
+        gfx.fillRect(0, 0, w, h - 24, rgb565::BLACK);
+        gfx.drawRect(4, 4, w - 8, h - 32, rgb565::CYAN);
+        gfx.fillRoundRect(20, 40, 120, 60, 8, rgb565::BLUE);
+        gfx.fillCircle(230, 120, 50, rgb565::DARKGREY);
+        gfx.drawLine(0, 0, w - 1, h - 1, rgb565::RED);
+        gfx.fillRect(0, h - 24, w, 24, rgb565::DARKGREY);
+        gfx.fillRect(4, h - 20, int16_t((i * 7) % (w - 8)), 16, rgb565::GREEN);
+    };
+
+    time_case(lcd, "dashboard full redraw", iterations, scene);
+    time_case(lcd, "status pane (pushClip)", iterations, [&](uint32_t i) {
+        gfx.pushClip(0, h - 24, w, 24);
+        scene(i);
+        gfx.popClip();
+    });
+}
+
+/**
+ * @brief 旋转测试：GFX旋转直接映射到MADCTL，四个方向的填充速度应一致；
+ *        接了MISO时回读矩形和字形，核对它们落在相同的逻辑坐标
+ */
+void bench_rotation(ILI9488DisplayAdapter::GFX& gfx) {
+    ILI9488Driver& lcd = gfx.getDriver();
+    const uint8_t original = gfx.getRotation();
+    const char* names[4] = {"rotation 0 fill", "rotation 90 fill", "rotation 180 fill", "rotation 270 fill"};
+
+    for (uint8_t rotation = 0; rotation < 4; ++rotation) {
+        gfx.setRotation(rotation);
+
+        uint64_t start = time_us_64();
+        for (int i = 0; i < 5; ++i) {
+            gfx.fillScreen((i & 1) ? rgb565::BLUE : rgb565::BLACK);
+        }
+        lcd.waitDMAComplete();
+        report(names[rotation], 5, uint64_t(gfx.width()) * gfx.height() * 3 * 5, time_us_64() - start);
+
+        // 黑底上逻辑坐标(10,20)的30x4红色矩形和(40,60)的字形'A'
+        gfx.fillRect(10, 20, 30, 4, rgb565::RED);
+        lcd.drawChar(40, 60, 'A', rgb888::WHITE, rgb888::BLACK);
+        lcd.waitDMAComplete();
+        if (!lcd.isReadbackEnabled()) {
+            printf("  %-28s %ux%u, placement check skipped: PIN_MISO not wired\n",
+                   names[rotation], gfx.width(), gfx.height());
+            continue;
+        }
+
+        uint16_t span[32 * 6];
+        uint16_t glyph[font::FONT_WIDTH * font::FONT_HEIGHT];
+        bool ok = lcd.readPixels(9, 19, 40, 24, span) &&
+                  lcd.readPixels(40, 60, 40 + font::FONT_WIDTH - 1, 60 + font::FONT_HEIGHT - 1, glyph);
+        for (int y = 0; ok && y < 6; ++y) {
+            for (int x = 0; x < 32; ++x) {
+                bool inside = x >= 1 && x <= 30 && y >= 1 && y <= 4;
+                if (span[y * 32 + x] != (inside ? rgb565::RED : rgb565::BLACK)) ok = false;
+            }
+        }
+        const uint8_t* bits = font::get_char_data('A');
+        for (int y = 0; ok && y < font::FONT_HEIGHT; ++y) {
+            for (int x = 0; x < font::FONT_WIDTH; ++x) {
+                bool set = bits[y] & (0x80 >> x);
+                if (glyph[y * font::FONT_WIDTH + x] != (set ? rgb565::WHITE : rgb565::BLACK)) ok = false;
+            }
+        }
+        printf("  %-28s %ux%u, span/glyph placement %s\n",
+               names[rotation], gfx.width(), gfx.height(), ok ? "OK" : "MISMATCH");
+    }
+
+    gfx.setRotation(original);
+    gfx.fillScreen(rgb565::BLACK);
+}
+
+/**
+ * @brief 多边形填充的逐行参考实现：每行逐条边求交，不用边表和增量
+ * @details 交点按 x1 + (y - y1) * (x2 - x1) / (y2 - y1) 整体向零截断，
+ *          与 polygon_raster 的定义一致，结果应逐像素相同
+ */
+template<typename Span>
+void reference_polygon_fill(const int16_t* vx, const int16_t* vy, uint8_t sides, Span&& span) {
+    int16_t miny = vy[0], maxy = vy[0];
+    for (uint8_t i = 1; i < sides; i++) {
+        miny = std::min(miny, vy[i]);
+        maxy = std::max(maxy, vy[i]);
+    }
+    int16_t nodes_x[64];
+    for (int16_t y = miny; y < maxy; y++) {
+        int nodes = 0;
+        for (uint8_t i = 0, j = sides - 1; i < sides; j = i++) {
+            int32_t y1 = vy[i], y2 = vy[j];
+            if ((y1 <= y && y2 > y) || (y2 <= y && y1 > y)) {
+                int64_t dy = y2 - y1;
+                int64_t num = int64_t(vx[i]) * dy + int64_t(y - y1) * (vx[j] - vx[i]);
+                if (dy < 0) {
+                    num = -num;
+                    dy = -dy;
+                }
+                nodes_x[nodes++] = int16_t(num / dy);  // 向零截断
+            }
+        }
+        std::sort(nodes_x, nodes_x + nodes);
+        for (int i = 0; i + 1 < nodes; i += 2) {
+            span(y, nodes_x[i], nodes_x[i + 1]);
+        }
+    }
+}
+
+/**
+ * @brief 多边形测试：随机多边形与参考实现逐像素对比（要求完全一致），
+ *        再测量GFX填充速度
+ */
+void bench_polygon(ILI9488DisplayAdapter::GFX& gfx, uint32_t iterations) {
+    ILI9488Driver& lcd = gfx.getDriver();
+    constexpr int kSize = 128;  // 对比区域128x128，1bpp
+    static uint32_t expected[kSize * kSize / 32];
+    static uint32_t actual[kSize * kSize / 32];
+
+    auto plot = [](uint32_t* mask, int16_t y, int16_t x0, int16_t x1) {
+        if (y < 0 || y >= kSize) return;
+        for (int16_t x = std::max<int16_t>(x0, 0); x <= x1 && x < kSize; ++x) {
+            mask[(y * kSize + x) / 32] |= 1u << (x % 32);
+        }
+    };
+
+    // 随机多边形（含自交和越界顶点），线性同余发生器保证每次运行相同；
+    // 顶点数3~40，超过32的走fill_polygon的堆上光栅器
+    uint32_t seed = 12345;
+    auto next = [&]() { seed = seed * 1103515245u + 12345u; return (seed >> 16) & 0x7FFF; };
+    uint32_t polygons = 0, differing = 0, diff_pixels = 0;
+    int16_t vx[40], vy[40];
+    for (int t = 0; t < 500; ++t) {
+        uint8_t n = uint8_t(3 + next() % 38);
+        for (uint8_t i = 0; i < n; ++i) {
+            vx[i] = int16_t(next() % (kSize + 20)) - 10;
+            vy[i] = int16_t(next() % (kSize + 20)) - 10;
+        }
+        std::memset(expected, 0, sizeof(expected));
+        std::memset(actual, 0, sizeof(actual));
+        reference_polygon_fill(vx, vy, n, [&](int16_t y, int16_t a, int16_t b) { plot(expected, y, a, b); });
+        bool filled = polygon_raster::fill_polygon(vx, vy, n, 0, kSize,
+                                                   [&](int16_t y, int16_t a, int16_t b) { plot(actual, y, a, b); });
+
+        uint32_t d = 0;
+        for (size_t i = 0; i < kSize * kSize / 32; ++i) {
+            d += __builtin_popcount(expected[i] ^ actual[i]);
+        }
+        ++polygons;
+        if (d || !filled) ++differing;
+        diff_pixels += d;
+    }
+    printf("  %-30s %s (%lu polygons, %lu differ, %lu pixels)\n", "random polygons vs reference",
+           differing == 0 ? "PASS" : "FAIL", static_cast<unsigned long>(polygons),
+           static_cast<unsigned long>(differing), static_cast<unsigned long>(diff_pixels));
+
+    // 填充速度：五角星（自交）和24边形
+    int16_t star_x[5], star_y[5], round_x[24], round_y[24];
+    for (int i = 0; i < 5; ++i) {
+        ili9488::fixed::polar_to_xy(160, 240, 150, ili9488::fixed::degrees(i * 144 - 90), star_x[i], star_y[i]);
+    }
+    for (int i = 0; i < 24; ++i) {
+        ili9488::fixed::polar_to_xy(160, 240, 150, ili9488::fixed::degrees(i * 15), round_x[i], round_y[i]);
+    }
+    time_case(lcd, "fillPolygon star r=150", iterations, [&](uint32_t i) {
+        gfx.fillPolygon(star_x, star_y, 5, (i & 1) ? rgb565::BLUE : rgb565::GREEN);
+    });
+    time_case(lcd, "fillPolygon 24-gon r=150", iterations, [&](uint32_t i) {
+        gfx.fillPolygon(round_x, round_y, 24, (i & 1) ? rgb565::BLUE : rgb565::GREEN);
+    });
+
+    // 只有光栅化（不发送）：衡量边表本身的开销
+    uint64_t start = time_us_64();
+    uint32_t spans = 0;
+    for (uint32_t i = 0; i < iterations; ++i) {
+        polygon_raster::fill_polygon(round_x, round_y, 24, 0, 480, [&](int16_t, int16_t, int16_t) { ++spans; });
+    }
+    report("rasterize 24-gon (no bus)", iterations, 0, time_us_64() - start);
+    (void)spans;
+}
+
+/**
+ * @brief 显示列表测试：模式切换时立即绘制与回放录制好的显示列表
+ * @details 接了MISO（已启用回读）时，再回读比较叠层界面优化前后的整帧
+ */
+void bench_display_list(const std::shared_ptr<ILI9488DisplayAdapter>& display, uint32_t iterations) {
+    ILI9488Driver& lcd = display->getDriver();
+    auto& gfx = *display->getGFX();
+    const int16_t w = display->get_width();
+    const int16_t h = display->get_height();
+    pico_ili9488_gfx::PicoILI9488ListTarget<ILI9488Driver> target(gfx);
+
+    auto optimize = [](const char* name, display_list::DisplayList<>& list) {
+        size_t recorded = list.size();
+        const auto& stats = list.optimize();
+        printf("  %-30s %u -> %u commands (%u culled, %u merged)\n", name,
+               static_cast<unsigned>(recorded), static_cast<unsigned>(list.size()),
+               static_cast<unsigned>(stats.culled), static_cast<unsigned>(stats.merged));
+    };
+
+    // 命令界面：与演示程序相同，清屏后逐个绘制 / 回放启动时录制的列表
+    time_case(lcd, "command screen (immediate)", iterations, [&](uint32_t) {
+        display->clear_screen(rgb666::BLACK);
+        gfx.drawRect(5, 5, w - 10, h - 10, rgb666_to_rgb565(rgb666::CYAN));
+        gfx.drawRect(10, 220, w - 20, 120, rgb666_to_rgb565(rgb666::BLUE));
+        for (const auto& t : kCommandScreen) {
+            display->draw_text(t.text, t.x, t.y, t.color, rgb666::BLACK);
+        }
+    });
+
+    static display_list::DisplayList<> command_list;
+    command_list.clear();
+    command_list.drawRect(5, 5, w - 10, h - 10, rgb666_to_rgb565(rgb666::CYAN));
+    command_list.drawRect(10, 220, w - 20, 120, rgb666_to_rgb565(rgb666::BLUE));
+    for (const auto& t : kCommandScreen) {
+        command_list.drawText(t.x, t.y, t.text, rgb666_to_rgb565(t.color), 0x0000);
+    }
+    optimize("command screen list", command_list);
+    time_case(lcd, "command screen (display list)", iterations, [&](uint32_t) {
+        display->clear_screen(rgb666::BLACK);
+        command_list.replay(target);
+    });
+
+    // 叠层界面：底色、标题栏、同色相邻的磁贴、被后画的对话框完全遮住的内容
+    static display_list::DisplayList<> layered;
+    layered.clear();
+    layered.fillRect(0, 0, w, h, rgb565::BLACK);
+    layered.fillRect(0, 0, w, 30, rgb565::BLUE);
+    layered.drawText(10, 7, "DASHBOARD", rgb565::WHITE, rgb565::BLUE);
+    for (int16_t row = 0; row < 4; ++row) {
+        for (int16_t col = 0; col < 4; ++col) {
+            layered.fillRect(col * 80, 40 + row * 60, 80, 60, rgb565::DARKGREY);
+        }
+        layered.drawText(8, 60 + row * 60, "channel", rgb565::WHITE, rgb565::DARKGREY);
+    }
+    layered.drawLine(0, 290, w - 1, 290, rgb565::CYAN);
+    layered.fillRect(40, 100, 240, 160, rgb565::NAVY);
+    layered.drawRect(40, 100, 240, 160, rgb565::WHITE);
+    layered.drawText(60, 170, "Saving...", rgb565::YELLOW, rgb565::NAVY);
+
+    static display_list::DisplayList<> layered_raw;
+    layered_raw = layered;
+    optimize("layered screen list", layered);
+    time_case(lcd, "layered screen (unoptimized)", iterations, [&](uint32_t) { layered_raw.replay(target); });
+    time_case(lcd, "layered screen (optimized)", iterations, [&](uint32_t) { layered.replay(target); });
+
+    // 优化前后的回放结果：从屏幕逐行回读整帧，FNV-1a一致即PASS（需接MISO）
+    if (!lcd.isReadbackEnabled()) {
+        printf("  %-30s skipped (readback not enabled)\n", "optimized replay readback");
+        return;
+    }
+    auto screen_hash = [&](const display_list::DisplayList<>& list) {
+        static uint16_t row[320];
+        list.replay(target);
+        lcd.waitDMAComplete();
+        uint32_t hash = 0x811C9DC5u;
+        for (int16_t y = 0; y < h; ++y) {
+            if (!lcd.readPixels(0, y, w - 1, y, row)) return 0u;
+            for (int16_t x = 0; x < w; ++x) {
+                hash = (hash ^ (row[x] & 0xFF)) * 0x01000193u;
+                hash = (hash ^ (row[x] >> 8)) * 0x01000193u;
+            }
+        }
+        return hash;
+    };
+    uint32_t raw_hash = screen_hash(layered_raw);
+    uint32_t optimized_hash = screen_hash(layered);
+    printf("  %-30s %s (0x%08lX / 0x%08lX)\n", "optimized replay readback",
+           raw_hash != 0 && raw_hash == optimized_hash ? "PASS" : "FAIL",
+           static_cast<unsigned long>(raw_hash), static_cast<unsigned long>(optimized_hash));
+}
+
+/**
+ * @brief 精灵测试：状态栏上的动画指示器与光标，手动整栏重绘与精灵层增量刷新对比
+ */
+void bench_sprites(ILI9488DisplayAdapter::GFX& gfx, uint32_t frames) {
+    ILI9488Driver& lcd = gfx.getDriver();
+    constexpr int16_t kBarH = ILI9488DisplayAdapter::STATUS_BAR_HEIGHT;
+    constexpr int16_t kSize = 16;
+    constexpr uint16_t kKey = rgb565::MAGENTA;
+    const int16_t bar_y = gfx.height() - kBarH;
+    const int16_t icon_y = bar_y + (kBarH - kSize) / 2;
+
+    // 4帧旋转指示器：圆环上亮一段，其余为色键（透明）
+    static uint16_t spinner[4][kSize * kSize];
+    for (int frame = 0; frame < 4; ++frame) {
+        for (int y = 0; y < kSize; ++y) {
+            for (int x = 0; x < kSize; ++x) {
+                int dx = 2 * x - (kSize - 1), dy = 2 * y - (kSize - 1);
+                int d2 = dx * dx + dy * dy;
+                bool ring = d2 >= 10 * 10 && d2 <= 15 * 15;
+                int quadrant = (dy < 0 ? 0 : 2) + ((dx < 0) != (dy < 0) ? 1 : 0);
+                spinner[frame][y * kSize + x] = !ring ? kKey : (quadrant == frame ? rgb565::YELLOW : rgb565::DARKGREY);
+            }
+        }
+    }
+    static uint16_t caret[2 * kSize];
+    std::fill(caret, caret + 2 * kSize, rgb565::WHITE);
+
+    auto draw_bar = [&]() {
+        gfx.fillRect(0, bar_y, gfx.width(), kBarH, rgb565::NAVY);
+        lcd.drawString(40, bar_y + 7, "UART 115200  RX 1234  TX 567", rgb888::WHITE, rgb888::NAVY);
+    };
+
+    // 手动方式：每帧重绘整个状态栏再画指示器
+    time_case(lcd, "status bar repaint per frame", frames, [&](uint32_t i) {
+        draw_bar();
+        gfx.drawBitmapFast(4 + (i % 16), icon_y, kSize, kSize, spinner[i % 4]);
+    });
+
+    // 精灵层：状态栏只画一次，之后每帧只发送新旧位置的并集
+    draw_bar();
+    static uint16_t before[320 * kBarH];
+    bool check = lcd.readPixels(0, bar_y, gfx.width() - 1, gfx.height() - 1, before);
+    gfx.setBlendBackground(rgb565::NAVY);  // 未接MISO时以状态栏底色作为精灵下方的背景
+
+    pico_ili9488_gfx::PicoILI9488SpriteLayer<ILI9488Driver> layer(gfx);
+    int icon = layer.addSprite(spinner[0], kSize, kSize);
+    int cursor = layer.addSprite(caret, 2, kSize);
+    layer.setColorKey(icon, kKey);
+    layer.moveTo(cursor, 30, icon_y);
+    layer.setVisible(icon, true);
+    layer.setVisible(cursor, true);
+    layer.update();
+
+    size_t windows = 0;
+    time_case(lcd, "status bar sprites per frame", frames, [&](uint32_t i) {
+        layer.setImage(icon, spinner[i % 4]);
+        layer.moveTo(icon, 4 + (i % 16), icon_y);
+        layer.setVisible(cursor, (i / 8) % 2 == 0);
+        windows += layer.update();
+    });
+    printf("  %-30s %lu windows\n", "sprite windows",
+           static_cast<unsigned long>(windows));
+
+    // 空闲帧：无变化时不应产生任何总线流量
+    time_case(lcd, "status bar sprites idle", frames, [&](uint32_t) {
+        layer.update();
+    });
+
+    // 隐藏后状态栏应与绘制精灵前一致（需接MISO）
+    layer.setVisible(icon, false);
+    layer.setVisible(cursor, false);
+    layer.update();
+    if (check) {
+        static uint16_t after[320 * kBarH];
+        lcd.readPixels(0, bar_y, gfx.width() - 1, gfx.height() - 1, after);
+        uint32_t differ = 0;
+        for (size_t i = 0; i < size_t(gfx.width()) * kBarH; ++i) {
+            differ += before[i] != after[i];
+        }
+        printf("  restored status bar            %s (%lu pixels differ)\n",
+               differ == 0 ? "PASS" : "FAIL", static_cast<unsigned long>(differ));
+    } else {
+        printf("  restored status bar            skipped (readback not enabled)\n");
+    }
+    gfx.setBlendBackground(rgb565::BLACK);
+}
+
+/**
+ * @brief 压缩图片测试：解码校验值与打包工具一致，测量解码速度与整屏平铺绘制
+ */
+void bench_image(ILI9488Driver& lcd, uint32_t iterations) {
+    const struct {
+        const char* name;
+        const uint8_t* data;
+        size_t size;
+        uint32_t hash;
+    } images[] = {
+        {"rgb666", assets::test_card_rgb666, sizeof(assets::test_card_rgb666), assets::test_card_rgb666_hash},
+        {"pal4", assets::test_card_pal4, sizeof(assets::test_card_pal4), assets::test_card_pal4_hash},
+    };
+
+    static uint8_t line[320 * 3];
+    for (const auto& image : images) {
+        ili9488::ImageDecoder decoder;
+        if (!decoder.begin(image.data, image.size)) {
+            printf("  %-30s FAIL (bad header)\n", image.name);
+            continue;
+        }
+        const size_t pixels = decoder.remaining();
+        printf("  %-30s %ux%u, %lu bytes packed (%lu raw RGB666)\n", image.name,
+               decoder.width(), decoder.height(), static_cast<unsigned long>(image.size),
+               static_cast<unsigned long>(pixels * 3));
+
+        // 黄金测试：解码后的RGB666字节流与打包时的FNV-1a一致
+        uint32_t hash = 0x811C9DC5u;
+        while (decoder.remaining() > 0) {
+            size_t batch = std::min<size_t>(decoder.remaining(), 320);
+            decoder.read(line, batch);
+            for (size_t i = 0; i < batch * 3; ++i) {
+                hash = (hash ^ line[i]) * 0x01000193u;
+            }
+        }
+        bool ok = hash == image.hash && !decoder.error();
+        printf("  %-30s %s (0x%08lX)\n", "decode hash", ok ? "PASS" : "FAIL",
+               static_cast<unsigned long>(hash));
+
+        // 截断的数据应解码为黑色并报告错误
+        decoder.begin(image.data, image.size / 2);
+        while (decoder.remaining() > 0) {
+            decoder.read(line, std::min<size_t>(decoder.remaining(), 320));
+        }
+        printf("  %-30s %s\n", "truncated stream", decoder.error() ? "PASS" : "FAIL");
+
+        // 只解码（不发送）
+        uint64_t start = time_us_64();
+        for (uint32_t i = 0; i < iterations; ++i) {
+            decoder.begin(image.data, image.size);
+            while (decoder.remaining() > 0) {
+                decoder.read(line, std::min<size_t>(decoder.remaining(), 320));
+            }
+        }
+        report("decode only (ops = images)", iterations, uint64_t(pixels) * 3 * iterations,
+               time_us_64() - start);
+
+        // 2x4平铺铺满320x480，每块一个窗口
+        time_case(lcd, "drawImage full-screen tiles", iterations, [&](uint32_t) {
+            for (uint16_t y = 0; y + decoder.height() <= lcd.getHeight(); y += decoder.height()) {
+                for (uint16_t x = 0; x + decoder.width() <= lcd.getWidth(); x += decoder.width()) {
+                    lcd.drawImage(x, y, image.data, image.size);
+                }
+            }
+        });
+    }
+}
+
+} // namespace
+
+int main() {
+    // 初始化标准库
+    stdio_init_all();
+    sleep_ms(2000);  // 等待USB串口连接
+
+    printf("\n=== ILI9488 Benchmark Starting ===\n");
+    printf("SPI: %lu Hz, Panel: %ux%u\n",
+           static_cast<unsigned long>(HardwareConfig::spi_speed),
+           HardwareConfig::width, HardwareConfig::height);
+
+    // 使用与主程序相同的显示适配器，驱动测试直接访问底层驱动
+    auto display = std::make_shared<ILI9488DisplayAdapter>();
+    if (!display->initialize()) {
+        printf("Failed to initialize ILI9488 display!\n");
+        return 1;
+    }
+    ILI9488Driver& lcd = display->getDriver();
+
+    // 测试1: 区域填充
+    printf("Test 1: Area fill\n");
+    bench_fill(lcd, "full screen black/white", 320, 480, rgb666::BLACK, rgb666::WHITE, 10);
+    bench_fill(lcd, "full screen red/blue", 320, 480, rgb666::RED, rgb666::BLUE, 10);
+    bench_fill(lcd, "100x100 red/blue", 100, 100, rgb666::RED, rgb666::BLUE, 100);
+    bench_fill(lcd, "text line 304x16 black", 304, 16, rgb666::BLACK, rgb666::BLACK, 200);
+    bench_fill(lcd, "glyph cell 8x16 green", 8, 16, rgb666::GREEN, rgb666::BLACK, 2000);
+
+    // 测试2: 文本绘制（ops/s 即每秒字符数）
+    printf("Test 2: Text rendering (ops = chars)\n");
+    lcd.fillScreenRGB666(rgb666::BLACK);
+    bench_text(lcd, 100);
+
+    // 测试3: 编辑器负载的总线开销
+    printf("Test 3: Editor workload bus traffic\n");
+    bench_editor(display);
+
+    // 测试4: 颜色转换与RGB565/RGB888批量推送
+    printf("Test 4: Color conversion and bulk pixel push\n");
+    bench_convert(lcd, 1000);
+
+    // 测试5: 像素推送（writePixels流水线）
+    printf("Test 5: Pixel push pipeline\n");
+    bench_push(lcd);
+
+    // 测试6: TE同步刷新
+    printf("Test 6: Tearing-effect synchronized fills\n");
+    bench_tearing(lcd);
+
+    // 测试7: 3位色模式的文本流量
+    printf("Test 7: 3-bit color mode text traffic\n");
+    bench_color_mode(lcd);
+
+    // 测试8: 帧缓冲的每帧节省字节数
+    printf("Test 8: Framebuffer bytes saved per frame\n");
+    bench_framebuffer(display);
+
+    // 测试9: 分条渲染
+    printf("Test 9: Band renderer vs immediate drawing\n");
+    bench_band(display, 10);
+
+    // 测试10: 字形缓存
+    printf("Test 10: Glyph cache\n");
+    bench_glyph_cache(lcd, 50);
+
+    // 测试11: GFX图元吞吐量
+    printf("Test 11: GFX primitives (ops = shapes)\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_primitives(*gfx, 200);
+    }
+
+    // 测试12: 位图推送
+    printf("Test 12: Bitmap blits\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_bitmap(*gfx, 10);
+    }
+
+    // 测试13: 抗锯齿线和圆
+    printf("Test 13: Anti-aliased lines and circles\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_antialias(*gfx, 100);
+    }
+
+    // 测试14: 半透明合成
+    printf("Test 14: Alpha compositing\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_alpha(*gfx, 20);
+    }
+
+    // 测试15: 渐变填充
+    printf("Test 15: Gradients (ops = frames)\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_gradient(*gfx, 10);
+    }
+
+    // 测试16: 定点三角函数与仪表盘
+    printf("Test 16: Fixed-point trig and gauge redraw\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_fixed_math(*gfx, 10000);
+    }
+
+    // 测试17: 控件增量刷新
+    printf("Test 17: Retained widgets, full redraw vs delta\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_widgets(*gfx, 400);
+    }
+
+    // 测试18: 文字描边与阴影
+    printf("Test 18: Outlined and shadowed text\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_text_effects(*gfx, 100);
+    }
+
+    // 测试19: 裁剪栈
+    printf("Test 19: Clip stack partial redraw\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_clip(*gfx, 50);
+    }
+
+    // 测试20: 硬件旋转
+    printf("Test 20: Hardware rotation (MADCTL)\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_rotation(*gfx);
+    }
+
+    // 测试21: 多边形填充
+    printf("Test 21: Polygon scanline fill\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_polygon(*gfx, 50);
+    }
+
+    // 测试22: 显示列表
+    printf("Test 22: Display list replay\n");
+    if (display->getGFX()) {
+        bench_display_list(display, 10);
+    }
+
+    // 测试23: 精灵层
+    printf("Test 23: Sprite layer on the status bar\n");
+    if (auto* gfx = display->getGFX()) {
+        bench_sprites(*gfx, 120);
+    }
+
+    // 测试24: 压缩图片流式解码
+    printf("Test 24: Packed image decode\n");
+    bench_image(lcd, 10);
+
+    printf("\n=== Benchmark complete ===\n");
+
+    while (true) {
+        sleep_ms(1000);
+    }
+
+    return 0;
+}
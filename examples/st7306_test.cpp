@@ -22,12 +22,69 @@
 #include "st7306_driver.hpp"
 #include "pico_display_gfx.hpp"
 #include "st73xx_font.hpp"
+#include "st73xx_display_list.hpp"
+#include "display_list.hpp"
 #include "gfx_colors.hpp"
 #include "pin_config.hpp"
 
 using namespace st7306;
 using HardwareConfig = pin_config::ST7306Config;  // 使用统一配置
 
+namespace {
+
+/**
+ * @brief 内存中的1bpp画布，用于检查显示列表回放的结果
+ */
+class CaptureUI : public ST73XX_UI {
+public:
+    CaptureUI() : ST73XX_UI(ST7306Driver::LCD_WIDTH, ST7306Driver::LCD_HEIGHT) { clear(); }
+
+    void writePoint(uint x, uint y, bool enabled) override {
+        uint32_t bit = y * ST7306Driver::LCD_WIDTH + x;
+        if (enabled) {
+            bits_[bit / 8] |= uint8_t(0x80 >> (bit % 8));
+        } else {
+            bits_[bit / 8] &= uint8_t(~(0x80 >> (bit % 8)));
+        }
+    }
+
+    void writePoint(uint x, uint y, uint16_t color) override {
+        writePoint(x, y, color != 0);
+    }
+
+    bool getPoint(uint x, uint y) const {
+        uint32_t bit = y * ST7306Driver::LCD_WIDTH + x;
+        return bits_[bit / 8] & (0x80 >> (bit % 8));
+    }
+
+    void clear() { std::memset(bits_, 0, sizeof(bits_)); }
+
+    bool operator==(const CaptureUI& other) const {
+        return std::memcmp(bits_, other.bits_, sizeof(bits_)) == 0;
+    }
+
+private:
+    uint8_t bits_[ST7306Driver::LCD_WIDTH * ST7306Driver::LCD_HEIGHT / 8];
+};
+
+/**
+ * @brief 录制一个有重叠的界面：被遮住的内容、可合并的同色矩形、线条和文本
+ */
+void record_test_screen(display_list::DisplayList<>& list) {
+    list.clear();
+    list.fillRect(0, 0, 300, 400, 0x0000);
+    list.drawText(20, 60, "hidden", 0xFFFF, 0x0000);  // 被下面的白色矩形完全遮住
+    list.fillRect(10, 50, 140, 40, 0xFFFF);
+    list.fillRect(150, 50, 140, 40, 0xFFFF);          // 与左半边合并成一个矩形
+    list.drawText(20, 62, "DISPLAY LIST", 0x0000, 0xFFFF);
+    list.drawRect(10, 110, 280, 200, 0xFFFF);
+    list.drawLine(10, 110, 289, 309, 0xFFFF);
+    list.drawLine(10, 309, 289, 110, 0xFFFF);
+    list.drawText(100, 330, "ST73XX target", 0xFFFF, 0x0000);
+}
+
+} // namespace
+
 int main() {
     // 初始化标准库
     stdio_init_all();
@@ -180,8 +237,45 @@ int main() {
     // 恢复高功耗模式
     display.highPowerMode();
     
+    // 测试7: 显示列表回放（ST73XXListTarget）
+    // 同一界面优化前后回放到内存画布，逐像素比较；再检查文本字形，最后回放到屏幕
+    printf("Test 7: Display list replay\n");
+    {
+        static display_list::DisplayList<> list;
+        static CaptureUI raw_canvas, optimized_canvas;
+        record_test_screen(list);
+        ST73XXListTarget raw_target(raw_canvas);
+        list.replay(raw_target);
+        
+        const auto& stats = list.optimize();
+        ST73XXListTarget optimized_target(optimized_canvas);
+        list.replay(optimized_target);
+        printf("  optimize: %u commands (%u culled, %u merged)\n",
+               static_cast<unsigned>(list.size()), static_cast<unsigned>(stats.culled),
+               static_cast<unsigned>(stats.merged));
+        printf("  optimized vs unoptimized replay: %s\n",
+               optimized_canvas == raw_canvas ? "PASS" : "FAIL");
+        
+        // "DISPLAY LIST" 的首字母在 (20, 62)：黑字白底
+        bool glyph_ok = true;
+        const uint8_t* glyph = font::get_char_data('D');
+        for (int row = 0; row < font::FONT_HEIGHT; ++row) {
+            for (int col = 0; col < font::FONT_WIDTH; ++col) {
+                bool set = (glyph[row] >> (7 - col)) & 0x01;
+                if (optimized_canvas.getPoint(20 + col, 62 + row) == set) glyph_ok = false;
+            }
+        }
+        printf("  text glyph placement: %s\n", glyph_ok ? "PASS" : "FAIL");
+        
+        display.clearDisplay();
+        ST73XXListTarget screen_target(gfx);
+        list.replay(screen_target);
+        display.display();
+        sleep_ms(3000);
+    }
+    
     // 测试完成
-    printf("Test 7: Test complete\n");
+    printf("Test 8: Test complete\n");
     display.clearDisplay();
     display.drawString(50, 180, "ST7306 Test Complete!", true);
     display.drawString(80, 200, "All tests passed", true);
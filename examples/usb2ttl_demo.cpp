@@ -18,6 +18,7 @@
  */
 
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <memory>
 
@@ -30,12 +31,15 @@
 #include "ttl_keyboard.hpp"
 #include "text_editor.hpp"
 #include "display_driver.hpp"
+#include "ili9488_display_adapter.hpp"
 
 // ILI9488驱动头文件
 #include "ili9488_driver.hpp"
 #include "pico_ili9488_gfx.hpp"
 #include "ili9488_colors.hpp"
 #include "ili9488_font.hpp"
+#include "pico_ili9488_display_list.hpp"
+#include "display_list.hpp"
 #include "pin_config.hpp"
 
 using namespace ili9488;
@@ -49,106 +53,52 @@ enum class AppState {
     EDIT_MODE       // 文本编辑模式
 };
 
-// ILI9488显示驱动适配器类
-class ILI9488DisplayAdapter : public DisplayDriver {
-private:
-    std::unique_ptr<ILI9488Driver> ili9488_driver_;
-    std::unique_ptr<pico_ili9488_gfx::PicoILI9488GFX<ILI9488Driver>> gfx_;
-    
+/**
+ * @brief 经过显示适配器的显示列表回放目标
+ * @details 没有GFX或启用了帧缓冲时使用：内容走适配器的fill_rect/draw_rect/draw_text，
+ * 写入帧缓冲并按硬件滚动映射坐标。适配器没有画线和位图接口，这两类逐像素用fill_rect绘制
+ */
+class AdapterListTarget {
 public:
-    ILI9488DisplayAdapter() {
-        ili9488_driver_ = std::make_unique<ILI9488Driver>(
-            HardwareConfig::spi_instance(),
-            HardwareConfig::pin_dc,
-            HardwareConfig::pin_rst,
-            HardwareConfig::pin_cs,
-            HardwareConfig::pin_sck,
-            HardwareConfig::pin_mosi,
-            HardwareConfig::pin_bl
-        );
-        
-        gfx_ = std::make_unique<pico_ili9488_gfx::PicoILI9488GFX<ILI9488Driver>>(
-            *ili9488_driver_, HardwareConfig::width, HardwareConfig::height
-        );
-        
-        width_ = HardwareConfig::width;
-        height_ = HardwareConfig::height;
-        font_width_ = font::FONT_WIDTH;
-        font_height_ = font::FONT_HEIGHT;
-        text_offset_x_ = 5;
-        text_offset_y_ = 5;
-    }
-    
-    bool initialize() override {
-        printf("Initializing ILI9488 display...\n");
-        
-        if (!ili9488_driver_->initialize()) {
-            printf("Failed to initialize ILI9488 driver!\n");
-            return false;
-        }
-        
-        ili9488_driver_->setRotation(Rotation::Portrait_180);
-        ili9488_driver_->fillScreenRGB666(rgb666::BLACK);
-        sleep_ms(100);
-        ili9488_driver_->setBacklight(true);
-        
-        printf("ILI9488 display initialized successfully!\n");
-        return true;
-    }
-    
-    void clear_screen(std::uint32_t color = rgb666::BLACK) override {
-        ili9488_driver_->fillScreenRGB666(color);
-    }
-    
-    void fill_rect(int x, int y, int width, int height, std::uint32_t color) override {
-        ili9488_driver_->fillAreaRGB666(x, y, x + width - 1, y + height - 1, color);
+    explicit AdapterListTarget(ILI9488DisplayAdapter& display) : display_(display) {}
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        display_.fill_rect(x, y, w, h, rgb565_to_rgb666(color));
     }
-    
-    void draw_text(const std::string& text, int x, int y, 
-                   std::uint32_t fg_color = rgb666::WHITE, 
-                   std::uint32_t bg_color = rgb666::BLACK) override {
-        uint32_t fg_rgb888 = rgb666_to_rgb888(fg_color);
-        uint32_t bg_rgb888 = rgb666_to_rgb888(bg_color);
-        ili9488_driver_->drawString(x, y, text.c_str(), fg_rgb888, bg_rgb888);
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        display_.draw_rect(x, y, w, h, rgb565_to_rgb666(color));
     }
-    
-    void draw_char(char ch, int x, int y, std::uint32_t fg_color = rgb666::WHITE, std::uint32_t bg_color = rgb666::BLACK) {
-        uint32_t fg_rgb888 = rgb666_to_rgb888(fg_color);
-        uint32_t bg_rgb888 = rgb666_to_rgb888(bg_color);
-        ili9488_driver_->drawChar(x, y, ch, fg_rgb888, bg_rgb888);
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+        const uint32_t rgb666 = rgb565_to_rgb666(color);
+        int dx = std::abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+        int dy = -std::abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+        int err = dx + dy;
+        int x = x0, y = y0;
+        while (true) {
+            display_.fill_rect(x, y, 1, 1, rgb666);
+            if (x == x1 && y == y1) break;
+            int e2 = 2 * err;
+            if (e2 >= dy) { err += dy; x += sx; }
+            if (e2 <= dx) { err += dx; y += sy; }
+        }
     }
-    
-    void draw_rect(int x, int y, int width, int height, std::uint32_t color) {
-        uint16_t rgb565_color = rgb666_to_rgb565(color);
-        gfx_->drawRect(x, y, width, height, rgb565_color);
+
+    void drawText(int16_t x, int16_t y, const char* str, uint16_t fg, uint16_t bg) {
+        display_.draw_text(str, x, y, rgb565_to_rgb666(fg), rgb565_to_rgb666(bg));
     }
-    
-    void set_backlight(float brightness) override {
-        if (brightness <= 0.0f) {
-            ili9488_driver_->setBacklight(false);
-        } else {
-            ili9488_driver_->setBacklight(true);
+
+    void drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels) {
+        for (int16_t j = 0; j < h; ++j) {
+            for (int16_t i = 0; i < w; ++i) {
+                display_.fill_rect(x + i, y + j, 1, 1, rgb565_to_rgb666(pixels[j * w + i]));
+            }
         }
     }
-    
-    void refresh() override {
-        // ILI9488驱动自动刷新，无需额外操作
-    }
-    
-    int get_width() const override { return ili9488_driver_->getWidth(); }
-    int get_height() const override { return ili9488_driver_->getHeight(); }
-    int get_font_width() const override { return font_width_; }
-    int get_font_height() const override { return font_height_; }
-    
-    pico_ili9488_gfx::PicoILI9488GFX<ILI9488Driver>* getGFX() { return gfx_.get(); }
-    
+
 private:
-    void show_initialization_screen() {
-        clear_screen(rgb666::BLACK);
-        draw_text("TTL Keyboard System", 60, 200, rgb666::CYAN, rgb666::BLACK);
-        draw_text("Initializing...", 100, 240, rgb666::YELLOW, rgb666::BLACK);
-        sleep_ms(1000);
-    }
+    ILI9488DisplayAdapter& display_;  ///< 显示适配器
 };
 
 // 全局变量
@@ -157,12 +107,14 @@ std::unique_ptr<TTLKeyboard> g_keyboard;
 std::unique_ptr<TextEditor> g_text_editor;
 AppState g_app_state = AppState::COMMAND_MODE;
 bool g_keyboard_connected = false;
+display_list::DisplayList<> g_command_screen;  ///< 命令界面（静态内容，首次显示时录制）
 
 // 函数声明
 void init_hardware();
 void init_display();
 void init_keyboard();
 void init_text_editor();
+void build_command_screen();
 void show_command_screen();
 void show_edit_mode();
 void handle_keyboard_input(const std::string& key);
@@ -211,6 +163,9 @@ int main() {
             last_status_update = now;
         }
         
+        // 启用帧缓冲时发送本轮的脏块，立即模式下为空操作
+        g_display->refresh();
+        
         sleep_ms(10);
     }
     
@@ -287,21 +242,23 @@ void init_text_editor() {
 }
 
 /**
- * @brief 显示键盘命令界面
+ * @brief 录制键盘命令界面
+ * @details 界面内容固定，录制一次并优化后，每次切换模式只需回放
  */
-void show_command_screen() {
-    g_display->clear_screen(rgb666::BLACK);
+void build_command_screen() {
+    auto& list = g_command_screen;
+    list.clear();
+    
+    const int16_t width = g_display->get_width();
+    const int16_t height = g_display->get_height();
+    const uint16_t black = rgb666_to_rgb565(rgb666::BLACK);
     
     // 绘制边框
-    auto* gfx = g_display->getGFX();
-    if (gfx) {
-        uint16_t cyan565 = rgb666_to_rgb565(rgb666::CYAN);
-        gfx->drawRect(5, 5, g_display->get_width() - 10, g_display->get_height() - 10, cyan565);
-    }
+    list.drawRect(5, 5, width - 10, height - 10, rgb666_to_rgb565(rgb666::CYAN));
     
     // 标题
-    g_display->draw_text("KEYBOARD COMMANDS", 70, 15, rgb666::YELLOW, rgb666::BLACK);
-    g_display->draw_text("=================", 70, 35, rgb666::CYAN, rgb666::BLACK);
+    list.drawText(70, 15, "KEYBOARD COMMANDS", rgb666_to_rgb565(rgb666::YELLOW), black);
+    list.drawText(70, 35, "=================", rgb666_to_rgb565(rgb666::CYAN), black);
     
     // 命令列表
     const struct {
@@ -316,28 +273,53 @@ void show_command_screen() {
         {"Tab", "Insert 4 spaces", rgb666::WHITE}
     };
     
-    int y_pos = 70;
+    int16_t y_pos = 70;
     for (size_t i = 0; i < sizeof(commands) / sizeof(commands[0]); ++i) {
-        g_display->draw_text(commands[i].key, 20, y_pos, commands[i].color, rgb666::BLACK);
-        g_display->draw_text("-", 120, y_pos, rgb666::YELLOW, rgb666::BLACK);
-        g_display->draw_text(commands[i].desc, 140, y_pos, rgb666::WHITE, rgb666::BLACK);
+        list.drawText(20, y_pos, commands[i].key, rgb666_to_rgb565(commands[i].color), black);
+        list.drawText(120, y_pos, "-", rgb666_to_rgb565(rgb666::YELLOW), black);
+        list.drawText(140, y_pos, commands[i].desc, rgb666_to_rgb565(rgb666::WHITE), black);
         y_pos += 25;
     }
     
     // 状态信息区域
-    if (gfx) {
-        uint16_t blue565 = rgb666_to_rgb565(rgb666::BLUE);
-        gfx->drawRect(10, 220, g_display->get_width() - 20, 120, blue565);
-    }
+    list.drawRect(10, 220, width - 20, 120, rgb666_to_rgb565(rgb666::BLUE));
     
-    g_display->draw_text("System Status:", 20, 230, rgb666::CYAN, rgb666::BLACK);
-    g_display->draw_text("TTL UART: Ready", 20, 250, rgb666::GREEN, rgb666::BLACK);
-    g_display->draw_text("Display: ILI9488 RGB666", 20, 270, rgb666::GREEN, rgb666::BLACK);
-    g_display->draw_text("Text Editor: Ready", 20, 290, rgb666::GREEN, rgb666::BLACK);
+    const uint16_t cyan = rgb666_to_rgb565(rgb666::CYAN);
+    const uint16_t green = rgb666_to_rgb565(rgb666::GREEN);
+    list.drawText(20, 230, "System Status:", cyan, black);
+    list.drawText(20, 250, "TTL UART: Ready", green, black);
+    list.drawText(20, 270, "Display: ILI9488 RGB666", green, black);
+    list.drawText(20, 290, "Text Editor: Ready", green, black);
     
     // 使用说明
-    g_display->draw_text("Connect keyboard via USB2TTL", 30, 360, rgb666::YELLOW, rgb666::BLACK);
-    g_display->draw_text("Press ENTER to start editing", 40, 380, rgb666::GREEN, rgb666::BLACK);
+    list.drawText(30, 360, "Connect keyboard via USB2TTL", rgb666_to_rgb565(rgb666::YELLOW), black);
+    list.drawText(40, 380, "Press ENTER to start editing", green, black);
+    
+    const auto& stats = list.optimize();
+    printf("Command screen recorded: %u commands (%u culled, %u merged)\n",
+           static_cast<unsigned>(list.size()), static_cast<unsigned>(stats.culled),
+           static_cast<unsigned>(stats.merged));
+}
+
+/**
+ * @brief 显示键盘命令界面
+ * @details 清屏仍经过适配器（复位硬件滚动和帧缓冲），其余内容回放录制的显示列表：
+ * 有GFX且未启用帧缓冲时直接回放到GFX，否则经适配器回放，内容不会丢失
+ */
+void show_command_screen() {
+    g_display->clear_screen(rgb666::BLACK);
+    
+    if (g_command_screen.empty()) {
+        build_command_screen();
+    }
+    auto* gfx = g_display->getGFX();
+    if (gfx && !g_display->has_framebuffer()) {
+        pico_ili9488_gfx::PicoILI9488ListTarget<ILI9488Driver> target(*gfx);
+        g_command_screen.replay(target);
+    } else {
+        AdapterListTarget target(*g_display);
+        g_command_screen.replay(target);
+    }
     
     g_app_state = AppState::COMMAND_MODE;
 }
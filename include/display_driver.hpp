@@ -118,9 +118,19 @@ public:
     
     /**
      * @brief 获取最大文本行数
-     * @return 最大行数
+     * @return 最大行数（派生类可排除状态栏等保留区域）
      */
-    int get_max_text_rows() const;
+    virtual int get_max_text_rows() const;
+    
+    /**
+     * @brief 将文本区域整体滚动若干行
+     * @param rows 滚动行数，正数向上滚动（内容上移），负数向下滚动
+     * @return true 显示内容已移动，调用者只需重绘新露出的行；
+     *         false 不支持滚动（默认实现），调用者需重绘整个文本区域
+     * @details 文本区域从第0行开始，共get_max_text_rows()行。支持硬件滚动的
+     * 派生类在滚动后仍按屏幕坐标接受绘制请求
+     */
+    virtual bool scroll_text_rows(int rows);
     
     /**
      * @brief 检查文本位置是否有效
@@ -0,0 +1,360 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace display_list {
+
+/**
+ * @brief Recorded drawing commands for a static screen
+ *
+ * Records rectangles, outlines, lines, text and bitmaps (RGB565) into fixed
+ * storage, so a screen can be built once and replayed on every mode switch.
+ * optimize() removes commands whose bounds are fully covered by a later
+ * opaque command (filled rectangle or bitmap), and merges same-color filled
+ * rectangles that form one rectangle when nothing drawn between them
+ * overlaps.
+ *
+ * replay() is backend independent: the target only needs
+ * fillRect(x, y, w, h, color), drawRect(x, y, w, h, color),
+ * drawLine(x0, y0, x1, y1, color), drawText(x, y, str, fg, bg) and
+ * drawBitmap(x, y, w, h, pixels). See PicoILI9488ListTarget and
+ * ST73XXListTarget.
+ *
+ * Text is copied into the list's arena; bitmap pixels are not copied and
+ * must outlive the list.
+ *
+ * @tparam MaxCommands Command capacity
+ * @tparam TextBytes Text arena size, including one terminator per string
+ */
+template<size_t MaxCommands = 64, size_t TextBytes = 1024>
+class DisplayList {
+public:
+    static constexpr int16_t GLYPH_WIDTH = 8;    ///< Text cell width (8x16 font of both cores)
+    static constexpr int16_t GLYPH_HEIGHT = 16;  ///< Text cell height
+
+    /**
+     * @brief Effect of the last optimize()
+     */
+    struct Stats {
+        size_t culled;  ///< Commands hidden by later opaque commands
+        size_t merged;  ///< Filled rectangles folded into a neighbour
+    };
+
+    // === Recording (false when the list or the text arena is full) ===
+
+    /**
+     * @brief Record an opaque filled rectangle
+     */
+    bool fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+    /**
+     * @brief Record a rectangle outline
+     */
+    bool drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+    /**
+     * @brief Record a line from (x0, y0) to (x1, y1)
+     */
+    bool drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+    /**
+     * @brief Record one line of text with an opaque background
+     */
+    bool drawText(int16_t x, int16_t y, const char* str, uint16_t fg, uint16_t bg);
+
+    /**
+     * @brief Record an opaque RGB565 bitmap (pixels are referenced, not copied)
+     */
+    bool drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels);
+
+    // === Editing ===
+
+    /**
+     * @brief Cull covered commands and merge adjacent same-color fills
+     * @details Replay output is unchanged. Call once after recording.
+     */
+    const Stats& optimize();
+
+    /**
+     * @brief Drop all commands and text
+     */
+    void clear();
+
+    /**
+     * @brief Draw the commands in recorded order
+     */
+    template<typename Target>
+    void replay(Target& target) const;
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    const Stats& stats() const { return stats_; }
+
+private:
+    enum class Op : uint8_t {
+        FillRect,
+        DrawRect,
+        DrawLine,
+        DrawText,
+        DrawBitmap
+    };
+
+    struct Command {
+        Op op;
+        int16_t x, y, w, h;        ///< Bounds of everything the command draws
+        int16_t x0, y0, x1, y1;    ///< Line end points (DrawLine)
+        uint16_t color;            ///< Fill, outline, line or text color
+        uint16_t bg;               ///< Text background (DrawText)
+        uint16_t text;             ///< Arena offset (DrawText)
+        const uint16_t* pixels;    ///< Bitmap pixels (DrawBitmap)
+    };
+
+    /**
+     * @brief Append a command with the given bounds
+     */
+    Command* add(Op op, int16_t x, int16_t y, int16_t w, int16_t h);
+
+    /**
+     * @brief Whether the command paints every pixel of its bounds
+     */
+    static bool isOpaque(const Command& cmd);
+
+    static bool contains(const Command& outer, const Command& inner);
+    static bool overlaps(const Command& a, const Command& b);
+
+    /**
+     * @brief Grow a filled rectangle by b when the union is a rectangle
+     */
+    static bool mergeInto(Command& a, const Command& b);
+
+    /**
+     * @brief Remove commands covered by a later opaque command
+     */
+    size_t cull();
+
+    /**
+     * @brief Fold same-color fills into the earliest one
+     */
+    size_t merge();
+
+    Command commands_[MaxCommands];
+    size_t count_ = 0;
+    char text_[TextBytes];
+    size_t text_used_ = 0;
+    Stats stats_{0, 0};
+};
+
+// === Template Method Implementations ===
+
+template<size_t MaxCommands, size_t TextBytes>
+typename DisplayList<MaxCommands, TextBytes>::Command*
+DisplayList<MaxCommands, TextBytes>::add(Op op, int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (count_ == MaxCommands) return nullptr;
+    Command& cmd = commands_[count_++];
+    cmd = Command{};
+    cmd.op = op;
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = w;
+    cmd.h = h;
+    return &cmd;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+bool DisplayList<MaxCommands, TextBytes>::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w <= 0 || h <= 0) return true;
+    Command* cmd = add(Op::FillRect, x, y, w, h);
+    if (!cmd) return false;
+    cmd->color = color;
+    return true;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+bool DisplayList<MaxCommands, TextBytes>::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w <= 0 || h <= 0) return true;
+    Command* cmd = add(Op::DrawRect, x, y, w, h);
+    if (!cmd) return false;
+    cmd->color = color;
+    return true;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+bool DisplayList<MaxCommands, TextBytes>::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int16_t left = x0 < x1 ? x0 : x1;
+    int16_t top = y0 < y1 ? y0 : y1;
+    Command* cmd = add(Op::DrawLine, left, top,
+                       int16_t((x0 < x1 ? x1 - x0 : x0 - x1) + 1),
+                       int16_t((y0 < y1 ? y1 - y0 : y0 - y1) + 1));
+    if (!cmd) return false;
+    cmd->x0 = x0;
+    cmd->y0 = y0;
+    cmd->x1 = x1;
+    cmd->y1 = y1;
+    cmd->color = color;
+    return true;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+bool DisplayList<MaxCommands, TextBytes>::drawText(int16_t x, int16_t y, const char* str, uint16_t fg, uint16_t bg) {
+    size_t len = std::strlen(str);
+    if (len == 0) return true;
+    if (text_used_ + len + 1 > TextBytes) return false;
+
+    Command* cmd = add(Op::DrawText, x, y, int16_t(len * GLYPH_WIDTH), GLYPH_HEIGHT);
+    if (!cmd) return false;
+    std::memcpy(text_ + text_used_, str, len + 1);
+    cmd->text = static_cast<uint16_t>(text_used_);
+    cmd->color = fg;
+    cmd->bg = bg;
+    text_used_ += len + 1;
+    return true;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+bool DisplayList<MaxCommands, TextBytes>::drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels) {
+    if (w <= 0 || h <= 0 || !pixels) return true;
+    Command* cmd = add(Op::DrawBitmap, x, y, w, h);
+    if (!cmd) return false;
+    cmd->pixels = pixels;
+    return true;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+void DisplayList<MaxCommands, TextBytes>::clear() {
+    count_ = 0;
+    text_used_ = 0;
+    stats_ = Stats{0, 0};
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+const typename DisplayList<MaxCommands, TextBytes>::Stats& DisplayList<MaxCommands, TextBytes>::optimize() {
+    stats_.culled = cull();
+    stats_.merged = merge();
+    // Merged fills can hide more commands
+    stats_.culled += cull();
+    return stats_;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+inline bool DisplayList<MaxCommands, TextBytes>::isOpaque(const Command& cmd) {
+    return cmd.op == Op::FillRect || cmd.op == Op::DrawBitmap;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+inline bool DisplayList<MaxCommands, TextBytes>::contains(const Command& outer, const Command& inner) {
+    return inner.x >= outer.x && inner.y >= outer.y &&
+           int32_t(inner.x) + inner.w <= int32_t(outer.x) + outer.w &&
+           int32_t(inner.y) + inner.h <= int32_t(outer.y) + outer.h;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+inline bool DisplayList<MaxCommands, TextBytes>::overlaps(const Command& a, const Command& b) {
+    return int32_t(a.x) < int32_t(b.x) + b.w && int32_t(b.x) < int32_t(a.x) + a.w &&
+           int32_t(a.y) < int32_t(b.y) + b.h && int32_t(b.y) < int32_t(a.y) + a.h;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+bool DisplayList<MaxCommands, TextBytes>::mergeInto(Command& a, const Command& b) {
+    if (a.op != Op::FillRect || b.op != Op::FillRect || a.color != b.color) return false;
+
+    // Same column span, touching or overlapping rows (or the transpose)
+    if (a.x == b.x && a.w == b.w && b.y <= a.y + a.h && a.y <= b.y + b.h) {
+        int16_t bottom = (a.y + a.h > b.y + b.h) ? int16_t(a.y + a.h) : int16_t(b.y + b.h);
+        a.y = a.y < b.y ? a.y : b.y;
+        a.h = bottom - a.y;
+        return true;
+    }
+    if (a.y == b.y && a.h == b.h && b.x <= a.x + a.w && a.x <= b.x + b.w) {
+        int16_t right = (a.x + a.w > b.x + b.w) ? int16_t(a.x + a.w) : int16_t(b.x + b.w);
+        a.x = a.x < b.x ? a.x : b.x;
+        a.w = right - a.x;
+        return true;
+    }
+    return false;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+size_t DisplayList<MaxCommands, TextBytes>::cull() {
+    // Walk backwards: a command is dead if an opaque command after it
+    // contains its bounds. Occluders only need containment, not adjacency.
+    size_t kept = count_;
+    bool dead[MaxCommands] = {};
+    for (size_t i = count_; i-- > 0;) {
+        for (size_t j = i + 1; j < count_; ++j) {
+            if (!dead[j] && isOpaque(commands_[j]) && contains(commands_[j], commands_[i])) {
+                dead[i] = true;
+                --kept;
+                break;
+            }
+        }
+    }
+
+    size_t out = 0;
+    for (size_t i = 0; i < count_; ++i) {
+        if (!dead[i]) commands_[out++] = commands_[i];
+    }
+    size_t culled = count_ - kept;
+    count_ = out;
+    return culled;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+size_t DisplayList<MaxCommands, TextBytes>::merge() {
+    // A later fill j moves back to fill i only if nothing drawn in between
+    // touches it, so every pixel still ends up with the same last writer
+    size_t merged = 0;
+    for (size_t i = 0; i < count_; ++i) {
+        if (commands_[i].op != Op::FillRect) continue;
+
+        bool grew = true;
+        while (grew) {
+            grew = false;
+            for (size_t j = i + 1; j < count_; ++j) {
+                const Command& candidate = commands_[j];
+                bool blocked = false;
+                for (size_t k = i + 1; k < j && !blocked; ++k) {
+                    blocked = overlaps(commands_[k], candidate);
+                }
+                if (blocked || !mergeInto(commands_[i], candidate)) continue;
+
+                for (size_t k = j; k + 1 < count_; ++k) {
+                    commands_[k] = commands_[k + 1];
+                }
+                --count_;
+                ++merged;
+                grew = true;
+                break;
+            }
+        }
+    }
+    return merged;
+}
+
+template<size_t MaxCommands, size_t TextBytes>
+template<typename Target>
+void DisplayList<MaxCommands, TextBytes>::replay(Target& target) const {
+    for (size_t i = 0; i < count_; ++i) {
+        const Command& cmd = commands_[i];
+        switch (cmd.op) {
+            case Op::FillRect:
+                target.fillRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.color);
+                break;
+            case Op::DrawRect:
+                target.drawRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.color);
+                break;
+            case Op::DrawLine:
+                target.drawLine(cmd.x0, cmd.y0, cmd.x1, cmd.y1, cmd.color);
+                break;
+            case Op::DrawText:
+                target.drawText(cmd.x, cmd.y, text_ + cmd.text, cmd.color, cmd.bg);
+                break;
+            case Op::DrawBitmap:
+                target.drawBitmap(cmd.x, cmd.y, cmd.w, cmd.h, cmd.pixels);
+                break;
+        }
+    }
+}
+
+} // namespace display_list
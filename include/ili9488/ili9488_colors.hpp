@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace ili9488_colors {
@@ -269,6 +270,45 @@ constexpr uint8_t blue888(uint32_t rgb888) {
     return rgb888 & 0xFF;
 }
 
+// === Batch Conversion to the RGB666 Wire Format ===
+
+/**
+ * @brief Convert RGB888 pixels to ILI9488 RGB666 wire bytes
+ * @param src Source pixels (0xRRGGBB)
+ * @param dst Destination buffer, 3 bytes per pixel (R, G, B with the low 2 bits cleared)
+ * @param count Number of pixels
+ */
+inline void rgb888_to_rgb666_bytes(const uint32_t* src, uint8_t* dst, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t c = src[i];
+        dst[0] = (c >> 16) & 0xFC;
+        dst[1] = (c >> 8) & 0xFC;
+        dst[2] = c & 0xFC;
+        dst += 3;
+    }
+}
+
+/**
+ * @brief Convert RGB565 pixels to ILI9488 RGB666 wire bytes
+ * @param src Source pixels
+ * @param dst Destination buffer, 3 bytes per pixel (R, G, B with the low 2 bits cleared)
+ * @param count Number of pixels
+ * @note 5-bit channels are widened by replicating their high bits, matching
+ *       ILI9488Driver::drawPixel()
+ */
+inline void rgb565_to_rgb666_bytes(const uint16_t* src, uint8_t* dst, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const uint16_t c = src[i];
+        const uint8_t r5 = (c >> 11) & 0x1F;
+        const uint8_t g6 = (c >> 5) & 0x3F;
+        const uint8_t b5 = c & 0x1F;
+        dst[0] = uint8_t((r5 << 3) | (r5 >> 2)) & 0xFC;
+        dst[1] = uint8_t(g6 << 2);
+        dst[2] = uint8_t((b5 << 3) | (b5 >> 2)) & 0xFC;
+        dst += 3;
+    }
+}
+
 // === Convenience Functions for Namespaces ===
 
 namespace rgb565 {
@@ -14,7 +14,8 @@ namespace ili9488 {
 enum class ColorMode {
     RGB565,    // 16-bit color
     RGB666,    // 18-bit color (native ILI9488)
-    RGB888     // 24-bit color
+    RGB888,    // 24-bit color
+    RGB111     // 3-bit color (8 colors, two pixels per byte)
 };
 
 /**
@@ -35,6 +36,47 @@ enum class Rotation {
     Landscape_270 = 3   // 270°
 };
 
+/**
+ * @brief SPI bus traffic counters
+ * 
+ * Cumulative since construction or the last resetBusStats(); take a
+ * snapshot before and after an operation to measure its cost.
+ */
+struct BusStats {
+    uint32_t commands = 0;        // Command bytes sent (DC low)
+    uint32_t cs_toggles = 0;      // CS assertions, i.e. SPI transactions
+    uint32_t bytes = 0;           // Bytes clocked out (commands, parameters and pixels)
+    uint32_t window_updates = 0;  // CASET/PASET commands actually sent
+    uint32_t window_skips = 0;    // CASET/PASET skipped because the range was unchanged
+};
+
+/**
+ * @brief Tearing-effect (TE) synchronization counters
+ */
+struct TearingStats {
+    uint32_t frames = 0;     // TE edges seen since enableTearingSync()
+    uint32_t period_us = 0;  // Last measured panel refresh period (0 until two edges)
+    uint32_t deferred = 0;   // DMA transfers held back until the next blanking period
+};
+
+/**
+ * @brief Glyph cache counters and memory use
+ */
+struct GlyphCacheStats {
+    uint32_t hits = 0;       // Glyph lookups served from the cache
+    uint32_t misses = 0;     // Glyphs expanded from the font bitmap
+    uint32_t evictions = 0;  // Least recently used glyphs replaced
+    uint32_t entries = 0;    // Glyphs currently cached
+    uint32_t capacity = 0;   // Glyphs that fit in the budget
+    uint32_t bytes = 0;      // RAM held by the cache (blocks and index)
+    
+    // Fraction of lookups served from the cache (0 when none were made)
+    float hitRate() const {
+        uint32_t lookups = hits + misses;
+        return lookups ? float(hits) / float(lookups) : 0.0f;
+    }
+};
+
 /**
  * @brief ILI9488 TFT LCD Driver Class
  * 
@@ -132,21 +174,74 @@ public:
     
     /**
      * @brief Write multiple pixels (RGB565)
+     * @note Pixels are converted one line at a time. With DMA the conversion
+     *       of the next line overlaps the transfer of the previous one and the
+     *       last line may still be in flight on return; the colors array is
+     *       no longer referenced and may be reused immediately.
      */
     void writePixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, 
                      const uint16_t* colors, size_t count);
     
     /**
      * @brief Write multiple pixels (RGB888)
+     * @note Same pipeline as writePixels()
      */
     void writePixelsRGB24(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
                           const uint32_t* colors, size_t count);
+    
+    /**
+     * @brief Write a window of 4bpp palette indices
+     * @param indices Byte holding column x0 of the first row; two pixels per
+     *                byte, the even pixel in the high nibble
+     * @param stride Source row pitch in bytes
+     * @param first_nibble 1 if column x0 is the low nibble of its byte
+     * @param palette RGB888 colors for indices 0..palette_size - 1 (max 16);
+     *                higher indices are drawn black
+     * @details Indices are expanded a line at a time into the pixel pipeline,
+     *          so a 4bpp frame buffer needs no RGB staging buffer.
+     */
+    void writePalette4Pixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                             const uint8_t* indices, size_t stride, size_t first_nibble,
+                             const uint32_t* palette, size_t palette_size);
+    
+    /**
+     * @brief Write a window of pixels read from a larger RGB565 image
+     * @param colors First pixel of the window in the source image
+     * @param stride Source row pitch in pixels (>= x1 - x0 + 1)
+     * @note Same pipeline as writePixels(); used for clipped bitmap blits
+     */
+    void writePixelsStrided(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                            const uint16_t* colors, size_t stride);
+    
+    /**
+     * @brief Write a window of pixels read from a larger RGB888 image
+     * @note Same pipeline as writePixels()
+     */
+    void writePixelsRGB24Strided(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                                 const uint32_t* colors, size_t stride);
+    
+    /**
+     * @brief Write a window colored from two 1bpp masks (RGB565 colors)
+     * @param mask Foreground bits, MSB = leftmost pixel, stride_words words per row
+     * @param edge_mask Bits drawn in edge_color where mask is clear (may be nullptr)
+     * @param first_bit Bit of each mask row that maps to column x0
+     * @details Pixels are expanded on the fly into the pixel pipeline, so
+     *          text effects cost one window and 3 bytes per pixel without an
+     *          intermediate color buffer.
+     */
+    void writeMaskPixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                         const uint32_t* mask, const uint32_t* edge_mask,
+                         size_t stride_words, size_t first_bit,
+                         uint16_t color, uint16_t edge_color, uint16_t bg_color);
 
 public:
     // === Area Fill Operations ===
     
     /**
      * @brief Fill rectangular area (RGB565)
+     * @note The window is streamed in one CS transaction. Uniform-byte colors
+     *       (black, white, grays) are sent by DMA and may still be in flight
+     *       when this returns; the next bus operation waits for them.
      */
     void fillArea(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
     
@@ -157,9 +252,38 @@ public:
     
     /**
      * @brief Fill rectangular area (RGB666 native)
+     * @note Same streaming/DMA behaviour as fillArea()
      */
     void fillAreaRGB666(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint32_t color666);
     
+    /**
+     * @brief Fill rectangular area with a linear RGB888 gradient
+     * @param color Color at (x0, y0)
+     * @param color_right Color at (x1, y0)
+     * @param color_bottom Color at (x0, y1)
+     * @details The colors form a plane, so (x1, y1) gets
+     *          color_right + color_bottom - color per channel, clamped to
+     *          0..255 where the plane leaves that range. Equal color and
+     *          color_bottom give a horizontal gradient, equal color and
+     *          color_right a vertical one. Channels
+     *          are stepped in 16.16 fixed point and the whole window is
+     *          streamed in one transaction through the pixel pipeline; a
+     *          horizontal gradient is one line that DMA resends per row.
+     */
+    void fillGradientRGB24(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                           uint32_t color, uint32_t color_right, uint32_t color_bottom);
+    
+    /**
+     * @brief Draw an image packed by tools/img_pack.py (see ImageDecoder)
+     * @param data Packed image, may stay in flash
+     * @return false if the data is not a packed image, the image does not
+     *         fit on screen at (x, y), or the stream is truncated
+     * @details Decoded straight into the pixel pipeline's line buffers, so a
+     *          full-screen image needs no frame-sized buffer; with DMA the
+     *          next line is decoded while the previous one is sent.
+     */
+    bool drawImage(uint16_t x, uint16_t y, const uint8_t* data, size_t size);
+    
     /**
      * @brief Fill entire screen (RGB565)
      */
@@ -188,6 +312,23 @@ public:
      */
     Rotation getRotation() const;
     
+    /**
+     * @brief Select the SPI pixel format
+     * @param mode RGB111 switches to 3-bit pixels (PIXFMT 0x61); any other mode
+     *             selects 18-bit RGB666 (PIXFMT 0x66)
+     * @details In RGB111 mode all drawing calls keep their color arguments; each
+     *          channel is rounded to 0 or full scale and two pixels are packed
+     *          per byte, sending 1/6 of the RGB666 traffic. Data passed to
+     *          writeDMA() is sent as-is. Before initialize() the mode is only
+     *          stored and applied by the init sequence.
+     */
+    void setColorMode(ColorMode mode);
+    
+    /**
+     * @brief Get the SPI pixel format (RGB666 or RGB111)
+     */
+    ColorMode getColorMode() const;
+    
     /**
      * @brief Control backlight on/off
      */
@@ -211,12 +352,110 @@ public:
      */
     void setPartialArea(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
     
+    /**
+     * @brief Define the vertical scrolling area (VSCRDEF)
+     * @param top_fixed Rows at the top of the screen that never scroll
+     * @param bottom_fixed Rows at the bottom of the screen that never scroll
+     * @return false in landscape rotations (the panel scrolls along its
+     *         480-row axis only) or if the fixed areas cover the screen
+     * @note Rows are in current-rotation coordinates; the scroll offset is reset to 0
+     */
+    bool setVerticalScrollArea(uint16_t top_fixed, uint16_t bottom_fixed);
+    
+    /**
+     * @brief Set the scroll offset within the scrolling area (VSCRSADD)
+     * @param offset Rows the content moves up; wraps at the scrolling area height
+     */
+    void setVerticalScrollOffset(uint16_t offset);
+    
+    /**
+     * @brief Get the current scroll offset
+     */
+    uint16_t getVerticalScrollOffset() const;
+    
+    /**
+     * @brief Whether a scrolling area is defined
+     * @details setRotation() and resetVerticalScroll() clear it, after which
+     *          setVerticalScrollOffset() has no effect
+     */
+    bool isVerticalScrollActive() const;
+    
+    /**
+     * @brief Return to a non-scrolled full-screen display
+     */
+    void resetVerticalScroll();
+    
+    /**
+     * @brief Map a screen row to the row that must be written to appear there
+     * @details Rows outside the scrolling area are returned unchanged. Inside it,
+     *          screen row y shows memory row top + (y - top + offset) % height.
+     */
+    uint16_t scrolledRow(uint16_t y) const;
+    
+    /**
+     * @brief Synchronize large transfers with the panel's TE output
+     * @param pin_te GPIO wired to the panel's TE pin
+     * @param min_pixels Windows with at least this many pixels are synchronized
+     * @return false if the driver is not initialized or has no DMA channel
+     * @details Sends TEON (V-blank mode) and catches TE rising edges with a
+     *          GPIO IRQ. A synchronized fill or pixel write opens its window
+     *          immediately but its DMA transfer is started from the TE IRQ, so
+     *          the call returns without waiting for the blanking period. The
+     *          write pointer starts right behind the scan; transfers longer than
+     *          one frame are overtaken by the scan at most once. If no edge
+     *          arrives for 100 ms a waiting transfer is started anyway.
+     */
+    bool enableTearingSync(uint8_t pin_te, uint32_t min_pixels = LCD_WIDTH * 64);
+    
+    /**
+     * @brief Stop TE synchronization (TEOFF) and release the GPIO IRQ
+     */
+    void disableTearingSync();
+    
+    /**
+     * @brief Check whether TE synchronization is active
+     */
+    bool isTearingSyncEnabled() const;
+    
+    /**
+     * @brief Get measured refresh period and number of deferred transfers
+     */
+    TearingStats getTearingStats() const;
+    
+    /**
+     * @brief Enable reading panel memory back over SPI (RAMRD)
+     * @param pin_miso GPIO wired to the panel's SDO pin (an RX pin of the SPI instance)
+     * @return false if the driver is not initialized or pin_miso is not an RX
+     *         pin of the configured SPI instance
+     */
+    bool enableReadback(uint8_t pin_miso);
+    
+    /**
+     * @brief Check whether panel readback is available
+     */
+    bool isReadbackEnabled() const;
+    
+    /**
+     * @brief Read a window of panel memory as RGB565
+     * @param colors Output, (x1 - x0 + 1) * (y1 - y0 + 1) pixels in row-major order
+     * @return false if readback is not enabled or the panel is in RGB111 mode
+     * @details Blocking. The bus is slowed to the panel's read clock limit for
+     *          the transfer. The panel returns 18-bit pixels, so the low
+     *          RGB888 bits written earlier are not recovered.
+     */
+    bool readPixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t* colors);
+    
     /**
      * @brief Write data using DMA (non-blocking)
      * @return true if DMA transfer started successfully
      */
     bool writeDMA(const uint8_t* data, size_t length);
     
+    /**
+     * @brief Check whether a DMA channel was claimed at initialization
+     */
+    bool isDMAAvailable() const;
+    
     /**
      * @brief Check if DMA transfer is busy
      */
@@ -249,6 +488,33 @@ public:
      * @brief Get string width in pixels
      */
     uint16_t getStringWidth(std::string_view str) const;
+    
+    /**
+     * @brief Cache expanded glyphs keyed by (character, foreground, background)
+     * @param budget_bytes RAM budget; each 8x16 glyph takes 384 bytes plus its index entry
+     * @details Text keeps fully expanded RGB666 glyph blocks in a fixed-size
+     *          LRU cache. A cached unclipped drawChar() is sent by DMA straight
+     *          from the cache; drawString() copies cached rows instead of
+     *          expanding font bits. Cells cut by the display edge use cached
+     *          glyphs but are never added. Re-enabling resizes and empties
+     *          the cache.
+     */
+    void enableGlyphCache(size_t budget_bytes = 16 * 1024);
+    
+    /**
+     * @brief Release the glyph cache and go back to expanding every glyph
+     */
+    void disableGlyphCache();
+    
+    /**
+     * @brief Get glyph cache hit/miss counters and memory use
+     */
+    GlyphCacheStats getGlyphCacheStats() const;
+    
+    /**
+     * @brief Reset glyph cache hit/miss/eviction counters (cached glyphs are kept)
+     */
+    void resetGlyphCacheStats();
 
 public:
     // === Font Control ===
@@ -280,6 +546,16 @@ public:
      * @brief Check if coordinates are within display bounds
      */
     bool isValidCoordinate(uint16_t x, uint16_t y) const;
+    
+    /**
+     * @brief Get SPI bus traffic counters
+     */
+    const BusStats& getBusStats() const;
+    
+    /**
+     * @brief Reset SPI bus traffic counters to zero
+     */
+    void resetBusStats();
 
 private:
     // Implementation details hidden in PIMPL
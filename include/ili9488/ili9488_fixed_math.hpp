@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ili9488 {
+namespace fixed {
+
+/**
+ * @brief Fixed-point trigonometry and interpolation for UI primitives
+ *
+ * The RP2040 has no FPU, so float sin/cos pull in soft-float library code.
+ * These helpers use integer math only:
+ *   - angles are binary angle units (BAM): a full turn is 65536, so angle
+ *     arithmetic wraps naturally in uint16_t;
+ *   - sine/cosine return Q15 (32767 = 1.0) from a 65-entry quarter-wave
+ *     table with linear interpolation (max error about 3 LSB);
+ *   - fractions for interpolation are Q16 (65536 = 1.0).
+ */
+
+using angle_t = uint16_t;
+
+constexpr angle_t ANGLE_QUARTER = 16384;  ///< 90 degrees
+constexpr angle_t ANGLE_HALF = 32768;     ///< 180 degrees
+constexpr int32_t Q15_ONE = 32767;        ///< Largest Q15 value (~1.0)
+constexpr uint32_t Q16_ONE = 65536;       ///< 1.0 in Q16
+
+/**
+ * @brief Quarter-wave sine table: sin(i * 90deg / 64) in Q15, i = 0..64
+ */
+constexpr int16_t SIN_QUARTER_Q15[65] = {
+    0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+    6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+    32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767,
+};
+
+/**
+ * @brief Convert whole degrees to binary angle units
+ */
+constexpr angle_t degrees(int32_t deg) {
+    int32_t wrapped = deg % 360;
+    if (wrapped < 0) wrapped += 360;
+    return static_cast<angle_t>((wrapped * 65536 + 180) / 360);
+}
+
+/**
+ * @brief Sine in Q15
+ */
+inline int16_t sin_q15(angle_t angle) {
+    // Fold into the first quadrant: 14 bits of angle per quadrant,
+    // 6 bits index the table and 8 bits interpolate
+    uint16_t quadrant = angle >> 14;
+    uint16_t offset = angle & 0x3FFF;
+    if (quadrant & 1) offset = ANGLE_QUARTER - offset;
+
+    uint16_t index = offset >> 8;
+    int32_t value = SIN_QUARTER_Q15[index];
+    if (index < 64) {
+        int32_t frac = offset & 0xFF;
+        value += ((SIN_QUARTER_Q15[index + 1] - value) * frac + 128) >> 8;
+    }
+    return static_cast<int16_t>((quadrant & 2) ? -value : value);
+}
+
+/**
+ * @brief Cosine in Q15
+ */
+inline int16_t cos_q15(angle_t angle) {
+    return sin_q15(static_cast<angle_t>(angle + ANGLE_QUARTER));
+}
+
+/**
+ * @brief Multiply an integer by a Q15 factor, rounded to nearest
+ */
+inline int32_t mul_q15(int32_t value, int32_t factor_q15) {
+    return (value * factor_q15 + (1 << 14)) >> 15;
+}
+
+/**
+ * @brief Position of value within [min_val, max_val] as a Q16 fraction
+ * @return 0 at or below min_val, Q16_ONE at or above max_val
+ */
+inline uint32_t fraction_q16(int32_t value, int32_t min_val, int32_t max_val) {
+    if (max_val <= min_val || value <= min_val) return 0;
+    if (value >= max_val) return Q16_ONE;
+    // Differences in 64 bits: max_val - min_val can exceed INT32_MAX
+    int64_t offset = int64_t(value) - min_val;
+    int64_t span = int64_t(max_val) - min_val;
+    return static_cast<uint32_t>((offset << 16) / span);
+}
+
+/**
+ * @brief Convert a float to Q16 (65536 = 1.0), rounded to nearest
+ * @details For passing float values to the Q16 helpers; NaN and values
+ *          below -32768 give INT32_MIN, values of 32768 and above INT32_MAX
+ */
+inline int32_t to_q16(float value) {
+    if (!(value >= -32768.0f)) return INT32_MIN;
+    if (value >= 32768.0f) return INT32_MAX;
+    float scaled = value * 65536.0f;
+    return static_cast<int32_t>(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+}
+
+/**
+ * @brief Linear interpolation a + (b - a) * t with t in Q16, rounded to nearest
+ */
+inline int32_t lerp(int32_t a, int32_t b, uint32_t t_q16) {
+    return a + static_cast<int32_t>((static_cast<int64_t>(b - a) * t_q16 + 0x8000) >> 16);
+}
+
+/**
+ * @brief Angle at fraction t (Q16) of the way from start to start + sweep
+ */
+inline angle_t lerp_angle(angle_t start, angle_t sweep, uint32_t t_q16) {
+    return static_cast<angle_t>(start + ((static_cast<uint32_t>(sweep) * t_q16) >> 16));
+}
+
+/**
+ * @brief Point at distance radius and angle from (cx, cy)
+ * @details Screen coordinates: angle 0 points right and angles grow clockwise
+ *          (y points down)
+ */
+inline void polar_to_xy(int32_t cx, int32_t cy, int32_t radius, angle_t angle,
+                        int16_t& x, int16_t& y) {
+    x = static_cast<int16_t>(cx + mul_q15(radius, cos_q15(angle)));
+    y = static_cast<int16_t>(cy + mul_q15(radius, sin_q15(angle)));
+}
+
+/**
+ * @brief Rotate (x, y) about the origin by angle
+ */
+inline void rotate(int32_t& x, int32_t& y, angle_t angle) {
+    int32_t c = cos_q15(angle);
+    int32_t s = sin_q15(angle);
+    int32_t rx = mul_q15(x, c) - mul_q15(y, s);
+    int32_t ry = mul_q15(x, s) + mul_q15(y, c);
+    x = rx;
+    y = ry;
+}
+
+} // namespace fixed
+} // namespace ili9488
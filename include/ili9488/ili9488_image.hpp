@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ili9488 {
+
+/**
+ * @brief Streaming decoder for images packed by tools/img_pack.py
+ *
+ * Layout (little-endian):
+ * - 12-byte header: "PIMG", version, format, width, height, palette size, 0
+ * - Palette: palette size entries of 3 bytes (6-bit R, G, B), PAL4 only
+ * - Pixel stream, row-major, runs may cross rows
+ *
+ * RLE_RGB666 is QOI-style over 6-bit channels, one op per pixel or run:
+ * - 00iiiiii: color from a 64-entry table of recent colors
+ * - 01rrggbb: previous color plus per-channel deltas of -2..1
+ * - 10gggggg rrrrbbbb: green delta -32..31, red/blue deltas relative to it -8..7
+ * - 11nnnnnn: previous color repeated n + 1 times (n < 63)
+ * - 11111111 r g b: literal color
+ * Deltas wrap modulo 64; the table slot is (r * 3 + g * 5 + b * 7) % 64.
+ *
+ * RLE_PAL4 uses up to 16 palette entries:
+ * - 0nnnnnnn: n + 1 literal 4-bit indices follow, high nibble first,
+ *   padded to a whole byte
+ * - 1nnnnnnn index: the index repeated n + 1 times
+ *
+ * read() emits RGB666 bus bytes (6-bit value << 2), so the decoder is a
+ * pixel source for the driver's line-buffer pipeline
+ * (ILI9488Driver::drawImage()). The packed data is never copied; it can
+ * stay in flash. Truncated or malformed data decodes as black and sets
+ * error().
+ */
+class ImageDecoder {
+public:
+    enum class Format : uint8_t {
+        RLE_RGB666 = 0,
+        RLE_PAL4 = 1
+    };
+
+    static constexpr size_t HEADER_SIZE = 12;
+    static constexpr uint8_t VERSION = 1;
+
+    /**
+     * @brief Parse the header and rewind to the first pixel
+     * @return false if data is not a supported image
+     */
+    bool begin(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Decode the next count pixels as RGB666 bytes (3 per pixel)
+     */
+    void read(uint8_t* rgb666, size_t count);
+
+    uint16_t width() const { return width_; }
+    uint16_t height() const { return height_; }
+    Format format() const { return format_; }
+
+    /**
+     * @brief Pixels not yet decoded
+     */
+    size_t remaining() const { return remaining_; }
+
+    /**
+     * @brief Whether the stream ended early or held an invalid op
+     */
+    bool error() const { return error_; }
+
+private:
+    void readRGB666(uint8_t* out, size_t count);
+    void readPAL4(uint8_t* out, size_t count);
+
+    /**
+     * @brief Next stream byte, or 0 with error() set at the end
+     */
+    uint8_t next();
+
+    const uint8_t* pos_ = nullptr;
+    const uint8_t* end_ = nullptr;
+    uint16_t width_ = 0;
+    uint16_t height_ = 0;
+    Format format_ = Format::RLE_RGB666;
+    size_t remaining_ = 0;
+    bool error_ = false;
+    uint8_t run_ = 0;               ///< Repeats left of the current color
+
+    // RLE_RGB666 state
+    uint8_t color_[3] = {};         ///< Previous color (6-bit channels)
+    uint8_t index_[64][3] = {};     ///< Recently seen colors
+
+    // RLE_PAL4 state
+    const uint8_t* palette_ = nullptr;
+    uint8_t palette_size_ = 0;
+    uint8_t run_index_ = 0;         ///< Palette index of the current run
+    uint8_t literal_ = 0;           ///< Literal indices left
+    uint8_t literal_byte_ = 0;      ///< Byte holding the next low nibble
+    bool low_nibble_ = false;       ///< Next literal index is literal_byte_'s low nibble
+};
+
+} // namespace ili9488
@@ -44,6 +44,87 @@ public:
      */
     virtual void writePixelRGB24(uint16_t x, uint16_t y, uint32_t color) = 0;
 
+public:
+    // === Span Hooks (override to accelerate filled primitives) ===
+    
+    /**
+     * @brief Fill a rectangle already clipped to the current clip
+     * @details All filled primitives reach the display through this hook and
+     *          the two line hooks below, with non-empty arguments inside the
+     *          clip (see pushClip()).
+     *          The default writes one pixel at a time; drivers with an area
+     *          fill should override it.
+     */
+    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    
+    /**
+     * @brief Draw a clipped horizontal span (defaults to writeFillRect)
+     */
+    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    
+    /**
+     * @brief Draw a clipped vertical span (defaults to writeFillRect)
+     */
+    virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+
+public:
+    // === Rotation Hook ===
+    
+    /**
+     * @brief Apply a rotation to the display hardware
+     * @details Called by setRotation() before the logical size changes.
+     *          Drawing coordinates are never transformed per pixel: derived
+     *          classes forward the rotation to the panel's address mapping
+     *          (ILI9488 MADCTL), so every orientation uses the same window
+     *          fills and blits. The default does nothing.
+     */
+    virtual void writeRotation(uint8_t rotation);
+
+public:
+    // === Clipping ===
+    
+    /**
+     * @brief Clip rectangle, half-open: [x0, x1) x [y0, y1)
+     */
+    struct ClipRect {
+        int16_t x0;
+        int16_t y0;
+        int16_t x1;
+        int16_t y1;
+    };
+    
+    static constexpr uint8_t CLIP_STACK_DEPTH = 8;  ///< Nested pushClip() levels
+    
+    /**
+     * @brief Intersect the clip with a rectangle, saving the previous clip
+     * @return false (clip unchanged) when CLIP_STACK_DEPTH levels are pushed
+     * @details Every primitive is clipped before its span hooks run, so
+     *          shapes entirely outside the clip reach no hook at all
+     */
+    bool pushClip(int16_t x, int16_t y, int16_t w, int16_t h);
+    
+    /**
+     * @brief Restore the clip saved by the matching pushClip()
+     */
+    void popClip();
+    
+    /**
+     * @brief Drop all pushed clips (clip = whole screen)
+     */
+    void resetClip();
+    
+    /**
+     * @brief Current clip rectangle (the screen when nothing is pushed)
+     */
+    const ClipRect& getClip() const;
+    
+    /**
+     * @brief Check if a rectangle overlaps the current clip
+     * @note Takes int32 so bounding boxes of int16 shapes (up to 65535 wide)
+     *       can be passed without overflow
+     */
+    bool isClipVisible(int32_t x, int32_t y, int32_t w, int32_t h) const;
+
 public:
     // === Basic Drawing Functions ===
     
@@ -54,16 +135,17 @@ public:
     
     /**
      * @brief Draw a line from (x0,y0) to (x1,y1)
+     * @details Straight runs of the Bresenham walk are emitted as spans
      */
     void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
     
     /**
-     * @brief Draw a fast vertical line
+     * @brief Draw a fast vertical line (clipped, then writeFastVLine)
      */
     void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
     
     /**
-     * @brief Draw a fast horizontal line
+     * @brief Draw a fast horizontal line (clipped, then writeFastHLine)
      */
     void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
 
@@ -76,7 +158,7 @@ public:
     void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     
     /**
-     * @brief Draw a filled rectangle
+     * @brief Draw a filled rectangle (clipped, then writeFillRect)
      */
     void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     
@@ -120,6 +202,9 @@ public:
     
     /**
      * @brief Draw a filled polygon
+     * @details Scanline fill with an active edge list (polygon_raster.hpp),
+     *          emitted as spans. Up to 32 vertices the edge table is on the
+     *          stack; larger polygons borrow about 7 KB of heap for the call.
      */
     void fillPolygon(const int16_t* x_points, const int16_t* y_points, uint8_t count, uint16_t color);
     
@@ -162,6 +247,8 @@ public:
     /**
      * @brief Set display rotation
      * @param rotation 0=0°, 1=90°, 2=180°, 3=270°
+     * @details Forwards to writeRotation(), then swaps the logical size
+     * @note Resets the clip stack to the rotated screen
      */
     void setRotation(uint8_t rotation);
     
@@ -187,10 +274,21 @@ public:
      * @brief Check if coordinates are within bounds
      */
     bool isValidCoordinate(int16_t x, int16_t y) const;
+    
+    /**
+     * @brief Check if coordinates are inside the current clip
+     */
+    bool isInClip(int16_t x, int16_t y) const;
 
 protected:
     // === Helper Functions ===
     
+    /**
+     * @brief Adopt a rotation already applied to the hardware
+     * @details Updates the logical size and clip without calling writeRotation()
+     */
+    void setRotationState(uint8_t rotation);
+    
     /**
      * @brief Helper function to draw circle quadrants
      */
@@ -214,6 +312,10 @@ protected:
     int16_t WIDTH;      ///< Display width as modified by current rotation
     int16_t HEIGHT;     ///< Display height as modified by current rotation
     uint8_t rotation_;  ///< Current rotation (0-3)
+    
+    ClipRect clip_;                              ///< Current clip (within the screen)
+    ClipRect clip_stack_[CLIP_STACK_DEPTH];      ///< Clips saved by pushClip()
+    uint8_t clip_depth_ = 0;                     ///< Pushed clips
 };
 
 // === Inline Implementations ===
@@ -234,6 +336,20 @@ inline bool ILI9488_UI::isValidCoordinate(int16_t x, int16_t y) const {
     return (x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT);
 }
 
+inline bool ILI9488_UI::isInClip(int16_t x, int16_t y) const {
+    return (x >= clip_.x0 && x < clip_.x1 && y >= clip_.y0 && y < clip_.y1);
+}
+
+inline const ILI9488_UI::ClipRect& ILI9488_UI::getClip() const {
+    return clip_;
+}
+
+inline bool ILI9488_UI::isClipVisible(int32_t x, int32_t y, int32_t w, int32_t h) const {
+    return w > 0 && h > 0 &&
+           x + w > clip_.x0 && x < clip_.x1 &&
+           y + h > clip_.y0 && y < clip_.y1;
+}
+
 inline void ILI9488_UI::swap(int16_t& a, int16_t& b) {
     int16_t temp = a;
     a = b;
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <vector>
+#include "ili9488_ui.hpp"
+
+namespace pico_ili9488_gfx {
+
+/**
+ * @brief Strip (band) renderer for ILI9488_UI primitives
+ *
+ * Rasterizes a scene one full-width band at a time into a small RGB565
+ * buffer and pushes each band with a single window and pixel write
+ * (DMA pipelined by the driver). The scene is a callable that issues
+ * ILI9488_UI drawing calls; it is replayed once per band and pixels
+ * outside the current band are discarded, so composite screens cost one
+ * window per band instead of one per pixel, with RAM bounded by
+ * width x band height x 2 bytes.
+ *
+ * @tparam Driver Display driver providing getWidth(), getHeight(),
+ *                getRotation()/setRotation() and
+ *                writePixels(x0, y0, x1, y1, const uint16_t*, count)
+ */
+template<typename Driver>
+class PicoILI9488BandRenderer : public ili9488::ILI9488_UI {
+public:
+    /**
+     * @brief Constructor
+     * @param driver Reference to the display driver
+     * @param band_height Rows per band (buffer is width x band_height RGB565)
+     */
+    explicit PicoILI9488BandRenderer(Driver& driver, int16_t band_height = 16);
+
+    /**
+     * @brief Destructor
+     */
+    ~PicoILI9488BandRenderer() override;
+
+public:
+    // === Implementation of ILI9488_UI Pure Virtual Functions ===
+
+    /**
+     * @brief Write a pixel into the current band (ignored outside it)
+     */
+    void writePixel(uint16_t x, uint16_t y, uint16_t color) override;
+
+    /**
+     * @brief Write an RGB888 pixel into the current band
+     */
+    void writePixelRGB24(uint16_t x, uint16_t y, uint32_t color) override;
+    
+    /**
+     * @brief Fill the part of a clipped rectangle inside the current band
+     */
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    
+    /**
+     * @brief Rotate the panel through the driver and resize the band buffer
+     */
+    void writeRotation(uint8_t rotation) override;
+
+public:
+    // === Band Rendering ===
+
+    /**
+     * @brief Render the whole screen band by band
+     * @param draw Callable taking ILI9488_UI& that draws the scene
+     * @details The scene is replayed once per band, with the band's rows
+     *          pushed as the clip rectangle.
+     */
+    template<typename Draw>
+    void render(Draw&& draw);
+
+    /**
+     * @brief Render only rows [y0, y1) band by band
+     */
+    template<typename Draw>
+    void render(int16_t y0, int16_t y1, Draw&& draw);
+
+    /**
+     * @brief Set the color each band is cleared to before the scene is replayed
+     */
+    void setBackground(uint16_t color);
+
+    /**
+     * @brief Draw text with the driver's 8x16 font (usable inside a scene)
+     */
+    void drawText(int16_t x, int16_t y, const char* str, uint16_t color, uint16_t bg);
+
+    /**
+     * @brief Rows per band
+     */
+    int16_t bandHeight() const;
+    
+    /**
+     * @brief Adopt the rotation the driver is currently set to
+     */
+    void syncRotation();
+
+private:
+    /**
+     * @brief Clear the buffer and select rows [y, y + rows)
+     */
+    void beginBand(int16_t y, int16_t rows);
+
+    /**
+     * @brief Push the current band in one window
+     */
+    void flushBand();
+
+    Driver& driver_;                ///< Reference to the underlying display driver
+    int16_t band_height_;           ///< Rows per band
+    int16_t band_y_ = 0;            ///< First row of the current band
+    int16_t band_rows_ = 0;         ///< Rows in the current band (last band may be shorter)
+    uint16_t background_ = 0x0000;  ///< Band clear color
+    std::vector<uint16_t> band_;    ///< RGB565 band buffer
+};
+
+// === Template Method Implementations ===
+
+template<typename Driver>
+template<typename Draw>
+inline void PicoILI9488BandRenderer<Driver>::render(Draw&& draw) {
+    render(0, height(), draw);
+}
+
+template<typename Driver>
+template<typename Draw>
+inline void PicoILI9488BandRenderer<Driver>::render(int16_t y0, int16_t y1, Draw&& draw) {
+    if (y0 < 0) y0 = 0;
+    if (y1 > height()) y1 = height();
+
+    for (int16_t y = y0; y < y1; y += band_height_) {
+        int16_t rows = (y1 - y < band_height_) ? int16_t(y1 - y) : band_height_;
+        beginBand(y, rows);
+        // Shapes outside the band then fail their bounding-box check and
+        // cost no rasterization; a full clip stack only loses that saving
+        bool clipped = pushClip(0, y, width(), rows);
+        draw(static_cast<ili9488::ILI9488_UI&>(*this));
+        if (clipped) popClip();
+        flushBand();
+    }
+}
+
+template<typename Driver>
+inline int16_t PicoILI9488BandRenderer<Driver>::bandHeight() const {
+    return band_height_;
+}
+
+} // namespace pico_ili9488_gfx
+
+// Include template implementation
+#include "pico_ili9488_band.inl"
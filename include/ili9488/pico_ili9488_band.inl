@@ -0,0 +1,113 @@
+// Template implementation file for PicoILI9488BandRenderer
+// This file should be included at the end of pico_ili9488_band.hpp
+
+#include <algorithm>
+#include "ili9488_colors.hpp"
+#include "ili9488_font.hpp"
+
+namespace pico_ili9488_gfx {
+
+template<typename Driver>
+PicoILI9488BandRenderer<Driver>::PicoILI9488BandRenderer(Driver& driver, int16_t band_height)
+    : ili9488::ILI9488_UI(driver.getWidth(), driver.getHeight()),
+      driver_(driver),
+      band_height_(band_height > 0 ? band_height : 1),
+      band_(size_t(driver.getWidth()) * band_height_) {
+    syncRotation();
+}
+
+template<typename Driver>
+PicoILI9488BandRenderer<Driver>::~PicoILI9488BandRenderer() {
+    // Destructor implementation
+}
+
+template<typename Driver>
+void PicoILI9488BandRenderer<Driver>::writePixel(uint16_t x, uint16_t y, uint16_t color) {
+    int16_t row = int16_t(y) - band_y_;
+    if (row < 0 || row >= band_rows_ || x >= uint16_t(width())) {
+        return;  // Outside the current band
+    }
+    band_[size_t(row) * width() + x] = color;
+}
+
+template<typename Driver>
+void PicoILI9488BandRenderer<Driver>::writePixelRGB24(uint16_t x, uint16_t y, uint32_t color) {
+    writePixel(x, y, ili9488_colors::rgb888_to_rgb565(color));
+}
+
+template<typename Driver>
+void PicoILI9488BandRenderer<Driver>::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                                     uint16_t color) {
+    int16_t row0 = std::max<int16_t>(y - band_y_, 0);
+    int16_t row1 = std::min<int16_t>(y + h - band_y_, band_rows_);
+    for (int16_t row = row0; row < row1; ++row) {
+        uint16_t* line = &band_[size_t(row) * width() + x];
+        std::fill(line, line + w, color);
+    }
+}
+
+template<typename Driver>
+void PicoILI9488BandRenderer<Driver>::writeRotation(uint8_t rotation) {
+    using Rotation = decltype(driver_.getRotation());
+    if (static_cast<uint8_t>(driver_.getRotation()) != rotation) {
+        driver_.setRotation(static_cast<Rotation>(rotation));
+    }
+    band_.resize(size_t(driver_.getWidth()) * band_height_);
+}
+
+template<typename Driver>
+void PicoILI9488BandRenderer<Driver>::syncRotation() {
+    // Unrotated size from the driver's current one
+    uint8_t rotation = static_cast<uint8_t>(driver_.getRotation()) & 3;
+    _width = (rotation & 1) ? driver_.getHeight() : driver_.getWidth();
+    _height = (rotation & 1) ? driver_.getWidth() : driver_.getHeight();
+    setRotationState(rotation);
+    band_.resize(size_t(width()) * band_height_);
+}
+
+template<typename Driver>
+void PicoILI9488BandRenderer<Driver>::setBackground(uint16_t color) {
+    background_ = color;
+}
+
+template<typename Driver>
+void PicoILI9488BandRenderer<Driver>::drawText(int16_t x, int16_t y, const char* str,
+                                                uint16_t color, uint16_t bg) {
+    using namespace font;
+
+    // Skip rows that cannot reach the current band
+    if (y + FONT_HEIGHT <= band_y_ || y >= band_y_ + band_rows_) {
+        return;
+    }
+
+    const ClipRect& clip = getClip();
+    int16_t row0 = std::max<int16_t>(std::max<int16_t>(band_y_, clip.y0) - y, 0);
+    int16_t row1 = std::min<int16_t>(std::min<int16_t>(band_y_ + band_rows_, clip.y1) - y, FONT_HEIGHT);
+    for (int16_t cx = x; *str && cx < clip.x1; ++str, cx += FONT_WIDTH) {
+        if (*str < 32 || *str > 126) continue;  // Non-printable: advance only
+        const uint8_t* glyph = get_char_data(*str);
+        for (int16_t row = row0; row < row1; ++row) {
+            uint8_t bits = glyph[row];
+            for (int16_t col = 0; col < FONT_WIDTH; ++col) {
+                int16_t px = cx + col;
+                if (px < clip.x0 || px >= clip.x1) continue;
+                writePixel(px, y + row, (bits & (0x80 >> col)) ? color : bg);
+            }
+        }
+    }
+}
+
+template<typename Driver>
+void PicoILI9488BandRenderer<Driver>::beginBand(int16_t y, int16_t rows) {
+    band_y_ = y;
+    band_rows_ = rows;
+    std::fill(band_.begin(), band_.begin() + size_t(width()) * rows, background_);
+}
+
+template<typename Driver>
+void PicoILI9488BandRenderer<Driver>::flushBand() {
+    size_t count = size_t(width()) * band_rows_;
+    driver_.writePixels(0, band_y_, width() - 1, band_y_ + band_rows_ - 1, band_.data(), count);
+}
+
+} // namespace pico_ili9488_gfx
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstring>
+#include "pico_ili9488_gfx.hpp"
+
+namespace pico_ili9488_gfx {
+
+/**
+ * @brief display_list::DisplayList replay target for PicoILI9488GFX
+ *
+ * Shapes and bitmaps go through the graphics layer (clipped, area fills
+ * and window blits). Text goes to the driver's glyph renderer, since the
+ * ILI9488_UI text path only draws placeholder cells; it is skipped when
+ * outside the clip but is otherwise clipped to the screen only.
+ *
+ * @tparam Driver Display driver type used by PicoILI9488GFX
+ */
+template<typename Driver>
+class PicoILI9488ListTarget {
+public:
+    explicit PicoILI9488ListTarget(PicoILI9488GFX<Driver>& gfx);
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void drawText(int16_t x, int16_t y, const char* str, uint16_t fg, uint16_t bg);
+    void drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels);
+
+private:
+    /**
+     * @brief RGB565 to RGB888 with the driver's bit replication
+     * @details Text then matches fills of the same RGB565 color
+     */
+    static uint32_t toRGB888(uint16_t color);
+
+    PicoILI9488GFX<Driver>& gfx_;  ///< Graphics layer
+};
+
+// === Template Method Implementations ===
+
+template<typename Driver>
+PicoILI9488ListTarget<Driver>::PicoILI9488ListTarget(PicoILI9488GFX<Driver>& gfx)
+    : gfx_(gfx) {
+}
+
+template<typename Driver>
+inline void PicoILI9488ListTarget<Driver>::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    gfx_.fillRect(x, y, w, h, color);
+}
+
+template<typename Driver>
+inline void PicoILI9488ListTarget<Driver>::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    gfx_.drawRect(x, y, w, h, color);
+}
+
+template<typename Driver>
+inline void PicoILI9488ListTarget<Driver>::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    gfx_.drawLine(x0, y0, x1, y1, color);
+}
+
+template<typename Driver>
+void PicoILI9488ListTarget<Driver>::drawText(int16_t x, int16_t y, const char* str, uint16_t fg, uint16_t bg) {
+    int16_t w = static_cast<int16_t>(std::strlen(str) * 8);
+    if (x < 0 || y < 0 || !gfx_.isClipVisible(x, y, w, 16)) return;
+    gfx_.getDriver().drawString(x, y, str, toRGB888(fg), toRGB888(bg));
+}
+
+template<typename Driver>
+inline void PicoILI9488ListTarget<Driver>::drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels) {
+    gfx_.drawBitmapFast(x, y, w, h, pixels);
+}
+
+template<typename Driver>
+inline uint32_t PicoILI9488ListTarget<Driver>::toRGB888(uint16_t color) {
+    uint32_t r5 = (color >> 11) & 0x1F;
+    uint32_t g6 = (color >> 5) & 0x3F;
+    uint32_t b5 = color & 0x1F;
+    return (((r5 << 3) | (r5 >> 2)) << 16) | (((g6 << 2) | (g6 >> 4)) << 8) | ((b5 << 3) | (b5 >> 2));
+}
+
+} // namespace pico_ili9488_gfx
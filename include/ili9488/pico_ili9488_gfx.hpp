@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vector>
 #include "ili9488_ui.hpp"
 
 namespace pico_ili9488_gfx {
@@ -47,43 +48,133 @@ public:
      */
     void writePixelRGB24(uint16_t x, uint16_t y, uint32_t color) override;
 
+public:
+    // === Span Hooks (driver area fill) ===
+    
+    /**
+     * @brief Fill a clipped rectangle with one driver area fill
+     */
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    
+    /**
+     * @brief Draw a clipped horizontal span with one driver area fill
+     */
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    
+    /**
+     * @brief Draw a clipped vertical span with one driver area fill
+     */
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    
+    /**
+     * @brief Program the rotation into the driver (MADCTL on ILI9488)
+     * @details Requires Driver::setRotation()/getRotation(); otherwise a no-op
+     */
+    void writeRotation(uint8_t rotation) override;
+
 public:
     // === Enhanced Drawing Functions ===
     
     /**
      * @brief Fast bitmap drawing with optimized transfer
+     * @details Clipped to the screen and streamed through one window by the
+     *          driver's pixel pipeline (DMA when available)
      */
     void drawBitmapFast(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* bitmap);
     
     /**
-     * @brief Fast RGB888 bitmap drawing
+     * @brief Fast RGB888 bitmap drawing (clipped, one window)
      */
     void drawBitmapRGB24Fast(int16_t x, int16_t y, int16_t w, int16_t h, const uint32_t* bitmap);
     
     /**
      * @brief Draw a gradient rectangle
+     * @param color1 RGB888 color at the left (horizontal) or top edge
+     * @param color2 RGB888 color at the right or bottom edge
+     * @details Clipped and streamed through one window by the driver's
+     *          fixed-point gradient engine
      */
     void drawGradient(int16_t x, int16_t y, int16_t w, int16_t h, 
                       uint32_t color1, uint32_t color2, bool horizontal = true);
     
+    /**
+     * @brief Draw a two-axis gradient rectangle
+     * @param top_left RGB888 color at (x, y)
+     * @param top_right RGB888 color at (x + w - 1, y)
+     * @param bottom_left RGB888 color at (x, y + h - 1)
+     * @details Linear in both axes; the bottom-right corner gets
+     *          top_right + bottom_left - top_left. A diagonal gradient from A
+     *          to B uses the midpoint of A and B for both top_right and
+     *          bottom_left.
+     */
+    void drawGradient2D(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint32_t top_left, uint32_t top_right, uint32_t bottom_left);
+    
     /**
      * @brief Draw anti-aliased line
+     * @details Xiaolin Wu's algorithm in 16.16 fixed point. Each step covers
+     *          two pixels across the line, blended against the blend
+     *          background; runs along the line are sent as 2-pixel-thick
+     *          windows of up to 32 steps instead of one window per pixel.
      */
     void drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
     
+    static constexpr int16_t MAX_CIRCLE_RADIUS = 4096;  ///< Largest radius drawCircleAA() draws
+    
     /**
      * @brief Draw anti-aliased circle
+     * @details Wu-style ring: one octant is computed with an integer square
+     *          root (8.8 fixed point) and mirrored into the other seven,
+     *          using the same batched runs as drawLineAA(). Radii above
+     *          MAX_CIRCLE_RADIUS are not drawn.
      */
     void drawCircleAA(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+    
+    /**
+     * @brief Set the color anti-aliased edges are blended against
+     * @details The panel cannot be read back cheaply, so partial coverage is
+     *          mixed with this known background (default black).
+     */
+    void setBlendBackground(uint16_t color);
 
 public:
     // === Advanced Graphics Effects ===
     
     /**
      * @brief Draw with transparency/alpha blending
+     * @details Same destination sources as fillRectAlpha()
      */
     void drawPixelAlpha(int16_t x, int16_t y, uint16_t color, uint8_t alpha);
     
+    /**
+     * @brief Composite a translucent rectangle over the current screen content
+     * @param alpha Opacity 0-255
+     * @details The destination is read in batches of up to ALPHA_SPAN_MAX
+     *          pixels (whole rows, or pieces of a wider row), blended, and
+     *          written back in one window per batch. It
+     *          comes from the shadow buffer when the batch lies inside it,
+     *          otherwise from panel RAM when the driver has readback enabled,
+     *          otherwise the blend background is assumed.
+     */
+    void fillRectAlpha(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t alpha);
+    
+    /**
+     * @brief Use a caller-owned RGB565 copy of a screen region as the blend source
+     * @param buffer w x h pixels, row-major (nullptr detaches)
+     * @details Writes made through this object inside the region (pixels,
+     *          spans, bitmaps, anti-aliased and alpha drawing) are mirrored
+     *          into the buffer. Content drawn through the driver directly is
+     *          not tracked; the caller refreshes the buffer after such writes.
+     */
+    void setShadowBuffer(uint16_t* buffer, int16_t x, int16_t y, int16_t w, int16_t h);
+    
+    /**
+     * @brief Read the current content of an on-screen window into pixels
+     * @details Same sources as fillRectAlpha(): the shadow buffer, then
+     *          panel RAM, then the blend background
+     */
+    void readDestination(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t* pixels);
+    
     /**
      * @brief Blend two colors with alpha
      */
@@ -97,32 +188,53 @@ public:
     
     /**
      * @brief Draw a gauge/meter
+     * @details Value and range are converted to Q16 (saturating beyond
+     *          +/-32768) and reduced to a fraction with integer math; the
+     *          needle is placed with fixed-point trigonometry (see
+     *          drawGaugeFraction)
      */
     void drawGauge(int16_t x, int16_t y, int16_t radius, 
                    float value, float min_val, float max_val,
                    uint16_t color, uint16_t bg_color);
+    
+    /**
+     * @brief Draw a gauge/meter from a Q16 fraction (0 = min, 65536 = max)
+     * @details Integer-only: use ili9488::fixed::fraction_q16(value, min, max)
+     *          to map integer readings without touching soft-float code
+     */
+    void drawGaugeFraction(int16_t x, int16_t y, int16_t radius, uint32_t fraction_q16,
+                           uint16_t color, uint16_t bg_color);
 
 public:
     // === Text Enhancement ===
     
     /**
      * @brief Draw text with shadow effect
+     * @details Single line in the driver's 8x16 font. The text and the
+     *          shifted shadow are rasterized into 1bpp masks and the
+     *          bounding box of both is streamed as one window on bg_color.
      */
     void drawStringWithShadow(int16_t x, int16_t y, const char* str, 
                               uint16_t color, uint16_t shadow_color, 
-                              int16_t shadow_offset_x = 1, int16_t shadow_offset_y = 1);
+                              int16_t shadow_offset_x = 1, int16_t shadow_offset_y = 1,
+                              uint16_t bg_color = 0x0000);
     
     /**
      * @brief Draw outlined text
+     * @details Single line in the driver's 8x16 font. The outline is the
+     *          text mask dilated by one pixel (bitwise OR of shifted rows);
+     *          text, outline and bg_color go out as one window.
      */
     void drawStringOutlined(int16_t x, int16_t y, const char* str,
-                            uint16_t color, uint16_t outline_color);
+                            uint16_t color, uint16_t outline_color,
+                            uint16_t bg_color = 0x0000);
 
 public:
     // === Performance Optimized Functions ===
     
     /**
      * @brief Bulk pixel write with DMA if available
+     * @details colors is a w x h row-major block; same path as drawBitmapFast()
      */
     void writePixelsBulk(int16_t x, int16_t y, int16_t w, int16_t h, 
                          const uint16_t* colors);
@@ -151,17 +263,100 @@ public:
     const Driver& getDriver() const;
     
     /**
-     * @brief Check if driver supports DMA
+     * @brief Check if driver supports DMA (a channel was claimed)
      */
     bool supportsDMA() const;
     
     /**
-     * @brief Check if driver supports partial refresh
+     * @brief Check if the driver type has a partial display area API (setPartialArea())
+     * @note Decided at compile time from Driver; the panel is not queried and
+     *       partial mode is not entered. Use the driver's setPartialMode() for that.
      */
     bool supportsPartialRefresh() const;
+    
+    /**
+     * @brief Adopt the rotation the driver is currently set to
+     * @details Call after rotating the driver directly so width(), height()
+     *          and getRotation() match the panel again
+     */
+    void syncRotation();
 
 private:
+    /**
+     * @brief Clip a w x h image at (x, y) to the screen
+     * @return false if nothing is visible; otherwise the visible window and
+     *         the offset of its first pixel in the image
+     */
+    bool clipImage(int16_t& x, int16_t& y, int16_t& w, int16_t& h,
+                   int16_t src_w, size_t& offset) const;
+    
+    /**
+     * @brief Queue one anti-aliased step: pixels (major, minor) and (major, minor + 1)
+     * @param steep true when major is the y axis
+     * @param cov_lo Coverage (0-255) of the pixel at minor
+     * @param cov_hi Coverage (0-255) of the pixel at minor + 1
+     * @details Steps with the same minor coordinate and consecutive major
+     *          coordinates are merged into one run
+     */
+    void plotAA(int16_t major, int16_t minor, bool steep,
+                uint8_t cov_lo, uint8_t cov_hi, uint16_t color);
+    
+    /**
+     * @brief Send the queued anti-aliased run as one window
+     */
+    void flushAA(uint16_t color);
+    
+    /**
+     * @brief Mirror a written window into the shadow buffer
+     */
+    template<typename Pixel>
+    void shadowWrite(int16_t x, int16_t y, int16_t w, int16_t h, const Pixel* pixels, size_t stride);
+    
+    /**
+     * @brief Mirror a filled window into the shadow buffer
+     */
+    void shadowFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    
+    /**
+     * @brief Rasterize str at (x, y) into a 1bpp mask covering (mx, my, mw, mh)
+     * @param mask Rows of stride words, MSB = leftmost column; bits are ORed in
+     */
+    void rasterizeText(uint32_t* mask, size_t stride, int16_t mx, int16_t my, int16_t mw, int16_t mh,
+                       int16_t x, int16_t y, const char* str) const;
+    
+    /**
+     * @brief Stream a masked text window and mirror it into the shadow buffer
+     * @param text Text mask rows (first row maps to y)
+     * @param edge Outline/shadow mask rows, same layout
+     */
+    void writeTextMask(int16_t x, int16_t y, int16_t w, int16_t h,
+                       const uint32_t* text, const uint32_t* edge, size_t stride, size_t first_bit,
+                       uint16_t color, uint16_t edge_color, uint16_t bg_color);
+
+    static constexpr int16_t AA_RUN_MAX = 32;      ///< Steps per anti-aliased run
+    static constexpr int16_t ALPHA_SPAN_MAX = 128; ///< Pixels per alpha batch (stack buffer)
+
     Driver& driver_; ///< Reference to the underlying display driver
+    uint16_t blend_background_ = 0x0000;  ///< Background for anti-aliased edges
+    
+    // Pending anti-aliased run
+    int16_t aa_major_ = 0;               ///< Major coordinate of the first step
+    int16_t aa_minor_ = 0;               ///< Minor coordinate shared by the run
+    int16_t aa_count_ = 0;               ///< Queued steps
+    bool aa_steep_ = false;              ///< Run advances along y
+    uint8_t aa_lo_[AA_RUN_MAX];          ///< Coverage at minor
+    uint8_t aa_hi_[AA_RUN_MAX];          ///< Coverage at minor + 1
+    uint16_t aa_pixels_[AA_RUN_MAX * 2]; ///< Blended window pixels
+    
+    // Optional shadow of a screen region used as the alpha blend source
+    uint16_t* shadow_ = nullptr;
+    int16_t shadow_x_ = 0;
+    int16_t shadow_y_ = 0;
+    int16_t shadow_w_ = 0;
+    int16_t shadow_h_ = 0;
+    
+    std::vector<uint32_t> text_mask_;      ///< Text and edge masks for text effects
+    std::vector<uint32_t> octant_;         ///< First-octant ring rows for drawCircleAA()
 };
 
 // === Template Method Implementations ===
@@ -1,14 +1,19 @@
 // Template implementation file for PicoILI9488GFX
 // This file should be included at the end of pico_ili9488_gfx.hpp
 
-#include <cmath>
+#include <algorithm>
+#include "ili9488_colors.hpp"
+#include "ili9488_fixed_math.hpp"
+#include "ili9488_font.hpp"
+#include <type_traits>
+#include <utility>
 
 namespace pico_ili9488_gfx {
 
 template<typename Driver>
 PicoILI9488GFX<Driver>::PicoILI9488GFX(Driver& driver, int16_t width, int16_t height)
     : ili9488::ILI9488_UI(width, height), driver_(driver) {
-    // Constructor implementation
+    syncRotation();
 }
 
 template<typename Driver>
@@ -20,61 +25,154 @@ template<typename Driver>
 void PicoILI9488GFX<Driver>::writePixel(uint16_t x, uint16_t y, uint16_t color) {
     // Delegate to the underlying driver
     driver_.drawPixel(x, y, color);
+    shadowFill(x, y, 1, 1, color);
 }
 
 template<typename Driver>
 void PicoILI9488GFX<Driver>::writePixelRGB24(uint16_t x, uint16_t y, uint32_t color) {
     // Delegate to the underlying driver
     driver_.drawPixelRGB24(x, y, color);
+    shadowFill(x, y, 1, 1, ili9488_colors::rgb888_to_rgb565(color));
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    // One window and a DMA fill instead of a window per pixel
+    driver_.fillArea(x, y, x + w - 1, y + h - 1, color);
+    shadowFill(x, y, w, h, color);
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    driver_.fillArea(x, y, x + w - 1, y, color);
+    shadowFill(x, y, w, 1, color);
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    driver_.fillArea(x, y, x, y + h - 1, color);
+    shadowFill(x, y, 1, h, color);
+}
+
+template<typename Driver>
+bool PicoILI9488GFX<Driver>::clipImage(int16_t& x, int16_t& y, int16_t& w, int16_t& h,
+                                       int16_t src_w, size_t& offset) const {
+    if (w <= 0 || h <= 0) return false;
+    
+    const ClipRect& clip = getClip();
+    int16_t skip_x = (x < clip.x0) ? clip.x0 - x : 0;
+    int16_t skip_y = (y < clip.y0) ? clip.y0 - y : 0;
+    int16_t x1 = static_cast<int16_t>(std::min<int>(x + w, clip.x1));
+    int16_t y1 = static_cast<int16_t>(std::min<int>(y + h, clip.y1));
+    x += skip_x;
+    y += skip_y;
+    if (x >= x1 || y >= y1) return false;
+    
+    w = x1 - x;
+    h = y1 - y;
+    offset = size_t(skip_y) * src_w + skip_x;
+    return true;
 }
 
 template<typename Driver>
 void PicoILI9488GFX<Driver>::drawBitmapFast(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* bitmap) {
-    // Simple fallback to standard bitmap drawing
-    ili9488::ILI9488_UI::drawBitmap(x, y, w, h, bitmap);
+    if (!bitmap) return;
+    
+    int16_t src_w = w;
+    size_t offset = 0;
+    if (!clipImage(x, y, w, h, src_w, offset)) return;
+    
+    // One window; clipped rows are gathered by the driver's strided pipeline
+    driver_.writePixelsStrided(x, y, x + w - 1, y + h - 1, bitmap + offset, src_w);
+    shadowWrite(x, y, w, h, bitmap + offset, src_w);
 }
 
 template<typename Driver>
 void PicoILI9488GFX<Driver>::drawBitmapRGB24Fast(int16_t x, int16_t y, int16_t w, int16_t h, const uint32_t* bitmap) {
-    // Simple fallback to standard RGB24 bitmap drawing
-    ili9488::ILI9488_UI::drawBitmapRGB24(x, y, w, h, bitmap);
+    if (!bitmap) return;
+    
+    int16_t src_w = w;
+    size_t offset = 0;
+    if (!clipImage(x, y, w, h, src_w, offset)) return;
+    
+    driver_.writePixelsRGB24Strided(x, y, x + w - 1, y + h - 1, bitmap + offset, src_w);
+    shadowWrite(x, y, w, h, bitmap + offset, src_w);
 }
 
 template<typename Driver>
 void PicoILI9488GFX<Driver>::clearScreenFast(uint16_t color) {
-    // Use base class method
-    ili9488::ILI9488_UI::fillScreen(color);
+    // Driver's full-screen fill
+    driver_.fillScreen(color);
 }
 
 template<typename Driver>
 void PicoILI9488GFX<Driver>::fillRectFast(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-    // Use base class method
+    // Clipped by the base class, then one area fill through writeFillRect()
     ili9488::ILI9488_UI::fillRect(x, y, w, h, color);
 }
 
+namespace detail {
+
+// Detects Driver::setPartialArea(x0, y0, x1, y1)
+template<typename Driver, typename = void>
+struct HasPartialArea : std::false_type {};
+
+template<typename Driver>
+struct HasPartialArea<Driver, decltype(void(std::declval<Driver&>().setPartialArea(0, 0, 0, 0)))>
+    : std::true_type {};
+
+// Detects Driver::setRotation(r) and Driver::getRotation()
+template<typename Driver, typename = void>
+struct HasRotation : std::false_type {};
+
+template<typename Driver>
+struct HasRotation<Driver, decltype(void(std::declval<Driver&>().setRotation(
+    std::declval<Driver&>().getRotation())))>
+    : std::true_type {};
+
+// Characters before the end of the first line
+inline int16_t textLength(const char* str) {
+    int16_t length = 0;
+    while (str[length] && str[length] != '\n') ++length;
+    return length;
+}
+
+} // namespace detail
+
 template<typename Driver>
 bool PicoILI9488GFX<Driver>::supportsDMA() const {
-    // For now, return false - can be enhanced later with proper feature detection
-    return false;
+    // A channel is claimed at initialization; without one the pipeline blocks
+    return driver_.isDMAAvailable();
 }
 
 template<typename Driver>
 bool PicoILI9488GFX<Driver>::supportsPartialRefresh() const {
-    // For now, return false - can be enhanced later with proper feature detection
-    return false;
+    // Only tells whether the API exists; every ILI9488 accepts PTLAR/PTLON
+    return detail::HasPartialArea<Driver>::value;
 }
 
 template<typename Driver>
-void PicoILI9488GFX<Driver>::writePixelsBulk(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* colors) {
-    // Simple pixel-by-pixel drawing fallback
-    const uint16_t* color_ptr = colors;
-    for (int16_t row = 0; row < h; ++row) {
-        for (int16_t col = 0; col < w; ++col) {
-            writePixel(x + col, y + row, *color_ptr++);
+void PicoILI9488GFX<Driver>::writeRotation(uint8_t rotation) {
+    if constexpr (detail::HasRotation<Driver>::value) {
+        using Rotation = decltype(driver_.getRotation());
+        if (static_cast<uint8_t>(driver_.getRotation()) != rotation) {
+            driver_.setRotation(static_cast<Rotation>(rotation));
         }
     }
 }
 
+template<typename Driver>
+void PicoILI9488GFX<Driver>::syncRotation() {
+    if constexpr (detail::HasRotation<Driver>::value) {
+        setRotationState(static_cast<uint8_t>(driver_.getRotation()));
+    }
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::writePixelsBulk(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* colors) {
+    drawBitmapFast(x, y, w, h, colors);
+}
+
 template<typename Driver>
 uint16_t PicoILI9488GFX<Driver>::blendColors(uint16_t fg, uint16_t bg, uint8_t alpha) {
     // Simple alpha blending for RGB565
@@ -90,25 +188,184 @@ uint16_t PicoILI9488GFX<Driver>::blendColors(uint16_t fg, uint16_t bg, uint8_t a
     uint8_t bg_g = (bg >> 5) & 0x3F;
     uint8_t bg_b = bg & 0x1F;
     
-    // Blend components
-    uint8_t r = (fg_r * alpha + bg_r * (255 - alpha)) / 255;
-    uint8_t g = (fg_g * alpha + bg_g * (255 - alpha)) / 255;
-    uint8_t b = (fg_b * alpha + bg_b * (255 - alpha)) / 255;
+    // Blend components with an 8-bit fixed-point weight (0-256, no division)
+    uint16_t a = alpha + (alpha >> 7);
+    uint8_t r = (fg_r * a + bg_r * (256 - a)) >> 8;
+    uint8_t g = (fg_g * a + bg_g * (256 - a)) >> 8;
+    uint8_t b = (fg_b * a + bg_b * (256 - a)) >> 8;
     
     // Recombine to RGB565
     return (r << 11) | (g << 5) | b;
 }
 
+template<typename Driver>
+void PicoILI9488GFX<Driver>::setBlendBackground(uint16_t color) {
+    blend_background_ = color;
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::plotAA(int16_t major, int16_t minor, bool steep,
+                                    uint8_t cov_lo, uint8_t cov_hi, uint16_t color) {
+    if (aa_count_ > 0 && (steep != aa_steep_ || minor != aa_minor_ ||
+                          major != aa_major_ + aa_count_ || aa_count_ == AA_RUN_MAX)) {
+        flushAA(color);
+    }
+    if (aa_count_ == 0) {
+        aa_major_ = major;
+        aa_minor_ = minor;
+        aa_steep_ = steep;
+    }
+    aa_lo_[aa_count_] = cov_lo;
+    aa_hi_[aa_count_] = cov_hi;
+    ++aa_count_;
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::flushAA(uint16_t color) {
+    if (aa_count_ == 0) return;
+    
+    // Window is count x 2 (shallow) or 2 x count (steep), row-major
+    int16_t x0 = aa_steep_ ? aa_minor_ : aa_major_;
+    int16_t y0 = aa_steep_ ? aa_major_ : aa_minor_;
+    int16_t w = aa_steep_ ? 2 : aa_count_;
+    int16_t h = aa_steep_ ? aa_count_ : 2;
+    for (int16_t i = 0; i < aa_count_; ++i) {
+        uint16_t lo = blendColors(color, blend_background_, aa_lo_[i]);
+        uint16_t hi = blendColors(color, blend_background_, aa_hi_[i]);
+        if (aa_steep_) {
+            aa_pixels_[i * 2] = lo;
+            aa_pixels_[i * 2 + 1] = hi;
+        } else {
+            aa_pixels_[i] = lo;
+            aa_pixels_[aa_count_ + i] = hi;
+        }
+    }
+    aa_count_ = 0;
+    
+    const ClipRect& clip = getClip();
+    if (x0 >= clip.x0 && y0 >= clip.y0 && x0 + w <= clip.x1 && y0 + h <= clip.y1) {
+        driver_.writePixels(x0, y0, x0 + w - 1, y0 + h - 1, aa_pixels_, size_t(w) * h);
+        shadowWrite(x0, y0, w, h, aa_pixels_, w);
+        return;
+    }
+    
+    // Partly outside the clip: clip pixel by pixel
+    for (int16_t j = 0; j < h; ++j) {
+        for (int16_t i = 0; i < w; ++i) {
+            drawPixel(x0 + i, y0 + j, aa_pixels_[j * w + i]);
+        }
+    }
+}
+
 template<typename Driver>
 void PicoILI9488GFX<Driver>::drawPixelAlpha(int16_t x, int16_t y, uint16_t color, uint8_t alpha) {
+    fillRectAlpha(x, y, 1, 1, color, alpha);
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::fillRectAlpha(int16_t x, int16_t y, int16_t w, int16_t h,
+                                           uint16_t color, uint8_t alpha) {
+    if (alpha == 0) return;
     if (alpha == 255) {
-        writePixel(x, y, color);
+        ili9488::ILI9488_UI::fillRect(x, y, w, h, color);
+        return;
+    }
+    
+    size_t offset = 0;
+    if (!clipImage(x, y, w, h, w, offset)) return;
+    
+    // Foreground weighted once; each pixel adds its weighted destination
+    uint16_t a = alpha + (alpha >> 7);
+    uint16_t inv = 256 - a;
+    uint16_t fg_r = ((color >> 11) & 0x1F) * a;
+    uint16_t fg_g = ((color >> 5) & 0x3F) * a;
+    uint16_t fg_b = (color & 0x1F) * a;
+    
+    // Whole rows per batch, or pieces of a row wider than the batch
+    uint16_t span[ALPHA_SPAN_MAX];
+    int16_t cols = std::min(w, ALPHA_SPAN_MAX);
+    int16_t rows_per_batch = std::max<int16_t>(1, ALPHA_SPAN_MAX / w);
+    for (int16_t row = 0; row < h; row += rows_per_batch) {
+        int16_t rows = std::min<int16_t>(rows_per_batch, h - row);
+        for (int16_t col = 0; col < w; col += cols) {
+            int16_t bw = std::min<int16_t>(cols, w - col);
+            size_t count = size_t(bw) * rows;
+            
+            readDestination(x + col, y + row, bw, rows, span);
+            for (size_t i = 0; i < count; ++i) {
+                uint16_t dst = span[i];
+                uint16_t r = (fg_r + ((dst >> 11) & 0x1F) * inv) >> 8;
+                uint16_t g = (fg_g + ((dst >> 5) & 0x3F) * inv) >> 8;
+                uint16_t b = (fg_b + (dst & 0x1F) * inv) >> 8;
+                span[i] = uint16_t((r << 11) | (g << 5) | b);
+            }
+            driver_.writePixels(x + col, y + row, x + col + bw - 1, y + row + rows - 1, span, count);
+            shadowWrite(x + col, y + row, bw, rows, span, bw);
+        }
+    }
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::setShadowBuffer(uint16_t* buffer, int16_t x, int16_t y, int16_t w, int16_t h) {
+    shadow_ = (w > 0 && h > 0) ? buffer : nullptr;
+    shadow_x_ = x;
+    shadow_y_ = y;
+    shadow_w_ = w;
+    shadow_h_ = h;
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::readDestination(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t* pixels) {
+    if (shadow_ && x >= shadow_x_ && y >= shadow_y_ &&
+        x + w <= shadow_x_ + shadow_w_ && y + h <= shadow_y_ + shadow_h_) {
+        for (int16_t row = 0; row < h; ++row) {
+            const uint16_t* src = shadow_ + size_t(y + row - shadow_y_) * shadow_w_ + (x - shadow_x_);
+            std::copy(src, src + w, pixels + size_t(row) * w);
+        }
         return;
     }
+    if (driver_.readPixels(x, y, x + w - 1, y + h - 1, pixels)) {
+        return;
+    }
+    std::fill(pixels, pixels + size_t(w) * h, blend_background_);
+}
+
+template<typename Driver>
+template<typename Pixel>
+void PicoILI9488GFX<Driver>::shadowWrite(int16_t x, int16_t y, int16_t w, int16_t h,
+                                         const Pixel* pixels, size_t stride) {
+    if (!shadow_) return;
     
-    // For alpha blending, we would need to read the current pixel value
-    // This is a simplified implementation
-    writePixel(x, y, color);
+    int16_t x0 = std::max(x, shadow_x_);
+    int16_t y0 = std::max(y, shadow_y_);
+    int16_t x1 = static_cast<int16_t>(std::min<int>(x + w, shadow_x_ + shadow_w_));
+    int16_t y1 = static_cast<int16_t>(std::min<int>(y + h, shadow_y_ + shadow_h_));
+    for (int16_t py = y0; py < y1; ++py) {
+        const Pixel* src = pixels + size_t(py - y) * stride + (x0 - x);
+        uint16_t* dst = shadow_ + size_t(py - shadow_y_) * shadow_w_ + (x0 - shadow_x_);
+        for (int16_t px = x0; px < x1; ++px) {
+            if constexpr (sizeof(Pixel) == 4) {
+                *dst++ = ili9488_colors::rgb888_to_rgb565(*src++);
+            } else {
+                *dst++ = *src++;
+            }
+        }
+    }
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::shadowFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!shadow_) return;
+    
+    int16_t x0 = std::max(x, shadow_x_);
+    int16_t y0 = std::max(y, shadow_y_);
+    int16_t x1 = static_cast<int16_t>(std::min<int>(x + w, shadow_x_ + shadow_w_));
+    int16_t y1 = static_cast<int16_t>(std::min<int>(y + h, shadow_y_ + shadow_h_));
+    if (x0 >= x1) return;
+    for (int16_t py = y0; py < y1; ++py) {
+        uint16_t* dst = shadow_ + size_t(py - shadow_y_) * shadow_w_;
+        std::fill(dst + (x0 - shadow_x_), dst + (x1 - shadow_x_), color);
+    }
 }
 
 template<typename Driver>
@@ -117,8 +374,9 @@ void PicoILI9488GFX<Driver>::drawProgressBar(int16_t x, int16_t y, int16_t w, in
     // Draw background
     ili9488::ILI9488_UI::fillRect(x, y, w, h, bg_color);
     
-    // Draw progress
-    int16_t progress_width = (w * progress) / 100;
+    // Draw progress (clamped to 100%)
+    int16_t progress_width = static_cast<int16_t>(
+        ili9488::fixed::lerp(0, w, ili9488::fixed::fraction_q16(progress, 0, 100)));
     if (progress_width > 0) {
         ili9488::ILI9488_UI::fillRect(x, y, progress_width, h, fg_color);
     }
@@ -127,67 +385,307 @@ void PicoILI9488GFX<Driver>::drawProgressBar(int16_t x, int16_t y, int16_t w, in
 template<typename Driver>
 void PicoILI9488GFX<Driver>::drawGradient(int16_t x, int16_t y, int16_t w, int16_t h, 
                                            uint32_t color1, uint32_t color2, bool horizontal) {
-    // Simple gradient implementation
-    for (int16_t i = 0; i < (horizontal ? w : h); i++) {
-        uint8_t alpha = (255 * i) / (horizontal ? w : h);
-        uint16_t blended = blendColors(static_cast<uint16_t>(color2), static_cast<uint16_t>(color1), alpha);
-        
-        if (horizontal) {
-            ili9488::ILI9488_UI::drawFastVLine(x + i, y, h, blended);
-        } else {
-            ili9488::ILI9488_UI::drawFastHLine(x, y + i, w, blended);
+    if (horizontal) {
+        drawGradient2D(x, y, w, h, color1, color2, color1);
+    } else {
+        drawGradient2D(x, y, w, h, color1, color1, color2);
+    }
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::drawGradient2D(int16_t x, int16_t y, int16_t w, int16_t h,
+                                             uint32_t top_left, uint32_t top_right, uint32_t bottom_left) {
+    const int16_t origin_x = x;
+    const int16_t origin_y = y;
+    const int32_t span_x = w - 1;
+    const int32_t span_y = h - 1;
+    
+    size_t offset = 0;
+    if (!clipImage(x, y, w, h, w, offset)) return;
+    
+    // Color of (px, py) on the plane through the three corners, rounded per channel
+    auto color_at = [&](int16_t px, int16_t py) -> uint32_t {
+        uint32_t result = 0;
+        for (int shift = 16; shift >= 0; shift -= 8) {
+            int32_t c = int32_t((top_left >> shift) & 0xFF);
+            int32_t v = c << 8;
+            if (span_x > 0) v += (int32_t((top_right >> shift) & 0xFF) - c) * (px - origin_x) * 256 / span_x;
+            if (span_y > 0) v += (int32_t((bottom_left >> shift) & 0xFF) - c) * (py - origin_y) * 256 / span_y;
+            v = std::min<int32_t>(std::max<int32_t>((v + 128) >> 8, 0), 255);
+            result |= uint32_t(v) << shift;
+        }
+        return result;
+    };
+    
+    // The visible part is the same plane through its own corners
+    driver_.fillGradientRGB24(x, y, x + w - 1, y + h - 1,
+                              color_at(x, y), color_at(x + w - 1, y), color_at(x, y + h - 1));
+    
+    if (shadow_) {
+        int16_t x1 = std::min<int16_t>(x + w, shadow_x_ + shadow_w_);
+        int16_t y1 = std::min<int16_t>(y + h, shadow_y_ + shadow_h_);
+        for (int16_t py = std::max(y, shadow_y_); py < y1; ++py) {
+            for (int16_t px = std::max(x, shadow_x_); px < x1; ++px) {
+                uint16_t c = ili9488_colors::rgb888_to_rgb565(color_at(px, py));
+                shadowFill(px, py, 1, 1, c);
+            }
         }
     }
 }
 
 template<typename Driver>
 void PicoILI9488GFX<Driver>::drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
-    // Simple fallback to regular line
-    ili9488::ILI9488_UI::drawLine(x0, y0, x1, y1, color);
+    // Coverage spills one pixel past the end points
+    if (!isClipVisible(std::min(x0, x1) - 1, std::min(y0, y1) - 1,
+                       std::abs(x1 - x0) + 3, std::abs(y1 - y0) + 3)) {
+        return;
+    }
+    
+    // Axis-aligned lines have full coverage
+    if (x0 == x1 || y0 == y1) {
+        ili9488::ILI9488_UI::drawLine(x0, y0, x1, y1, color);
+        return;
+    }
+    
+    bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+    if (steep) {
+        swap(x0, y0);
+        swap(x1, y1);
+    }
+    if (x0 > x1) {
+        swap(x0, x1);
+        swap(y0, y1);
+    }
+    
+    // 16.16 fixed-point minor coordinate; the top 8 fraction bits are the
+    // coverage of the second pixel of each step
+    int32_t gradient = (int32_t(y1 - y0) << 16) / (x1 - x0);
+    int32_t intery = int32_t(y0) << 16;
+    for (int16_t x = x0; x <= x1; ++x) {
+        uint8_t frac = static_cast<uint8_t>(intery >> 8);
+        plotAA(x, static_cast<int16_t>(intery >> 16), steep, 255 - frac, frac, color);
+        intery += gradient;
+    }
+    flushAA(color);
 }
 
 template<typename Driver>
 void PicoILI9488GFX<Driver>::drawCircleAA(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
-    // Simple fallback to regular circle
-    ili9488::ILI9488_UI::drawCircle(x0, y0, r, color);
+    if (r <= 0) {
+        drawPixel(x0, y0, color);
+        return;
+    }
+    if (r > MAX_CIRCLE_RADIUS) return;
+    if (!isClipVisible(x0 - r - 1, y0 - r - 1, 2 * r + 3, 2 * r + 3)) return;
+    
+    // First octant (x from 0 up to the diagonal): y = sqrt(r^2 - x^2) in
+    // 8.8 fixed point, by bitwise integer square root. Roots reach r * 256,
+    // so they need 32 bits from r = 256 on.
+    octant_.clear();
+    uint32_t r2 = uint32_t(r) * r;
+    for (int16_t x = 0; ; ++x) {
+        uint64_t value = uint64_t(r2 - uint32_t(x) * x) << 16;
+        uint64_t root = 0;
+        for (uint64_t bit = uint64_t(1) << 40; bit; bit >>= 2) {
+            if (value >= root + bit) {
+                value -= root + bit;
+                root = (root >> 1) + bit;
+            } else {
+                root >>= 1;
+            }
+        }
+        if (root < (uint32_t(x) << 8)) break;  // Past the diagonal
+        octant_.push_back(static_cast<uint32_t>(root));
+    }
+    const int16_t count = static_cast<int16_t>(octant_.size());
+    const uint32_t* octant = octant_.data();
+    
+    // Mirror into eight octants. Each step covers the ring pixel (cov 1 - frac)
+    // and its outer neighbour (cov frac); steps are emitted with the major
+    // coordinate increasing so plotAA() can merge them into runs.
+    for (int octant_index = 0; octant_index < 8; ++octant_index) {
+        bool steep = octant_index & 4;           // Major axis is y
+        int16_t major_sign = (octant_index & 1) ? -1 : 1;
+        int16_t minor_sign = (octant_index & 2) ? -1 : 1;
+        int16_t major_center = steep ? y0 : x0;
+        int16_t minor_center = steep ? x0 : y0;
+        
+        for (int16_t k = 0; k < count; ++k) {
+            int16_t i = (major_sign > 0) ? k : count - 1 - k;
+            int16_t y = octant[i] >> 8;
+            uint8_t frac = octant[i] & 0xFF;
+            int16_t major = major_center + major_sign * i;
+            if (minor_sign > 0) {
+                plotAA(major, minor_center + y, steep, 255 - frac, frac, color);
+            } else {
+                plotAA(major, minor_center - y - 1, steep, frac, 255 - frac, color);
+            }
+        }
+        flushAA(color);
+    }
 }
 
 template<typename Driver>
 void PicoILI9488GFX<Driver>::drawStringWithShadow(int16_t x, int16_t y, const char* str, 
                                                    uint16_t color, uint16_t shadow_color, 
-                                                   int16_t shadow_offset_x, int16_t shadow_offset_y) {
-    // Draw shadow first
-    ili9488::ILI9488_UI::drawString(x + shadow_offset_x, y + shadow_offset_y, str, shadow_color, 0, 1);
-    // Draw main text
-    ili9488::ILI9488_UI::drawString(x, y, str, color, 0, 1);
+                                                   int16_t shadow_offset_x, int16_t shadow_offset_y,
+                                                   uint16_t bg_color) {
+    if (!str) return;
+    int16_t text_w = detail::textLength(str) * font::FONT_WIDTH;
+    if (text_w == 0) return;
+    
+    // Bounding box of text and shadow, clipped
+    const ClipRect& clip = getClip();
+    int16_t x0 = std::max<int16_t>(std::min<int16_t>(x, x + shadow_offset_x), clip.x0);
+    int16_t y0 = std::max<int16_t>(std::min<int16_t>(y, y + shadow_offset_y), clip.y0);
+    int16_t x1 = std::min<int16_t>(std::max<int16_t>(x, x + shadow_offset_x) + text_w, clip.x1);
+    int16_t y1 = std::min<int16_t>(std::max<int16_t>(y, y + shadow_offset_y) + font::FONT_HEIGHT, clip.y1);
+    if (x0 >= x1 || y0 >= y1) return;
+    
+    int16_t w = x1 - x0;
+    int16_t h = y1 - y0;
+    size_t stride = (size_t(w) + 31) / 32;
+    size_t plane = stride * h;
+    text_mask_.assign(plane * 2, 0);
+    uint32_t* text = text_mask_.data();
+    uint32_t* shadow = text + plane;
+    
+    // The shadow mask is the text mask shifted by the offset
+    rasterizeText(text, stride, x0, y0, w, h, x, y, str);
+    rasterizeText(shadow, stride, x0, y0, w, h, x + shadow_offset_x, y + shadow_offset_y, str);
+    
+    writeTextMask(x0, y0, w, h, text, shadow, stride, 0, color, shadow_color, bg_color);
 }
 
 template<typename Driver>
 void PicoILI9488GFX<Driver>::drawStringOutlined(int16_t x, int16_t y, const char* str,
-                                                 uint16_t color, uint16_t outline_color) {
-    // Draw outline in 8 directions
-    for (int8_t dx = -1; dx <= 1; dx++) {
-        for (int8_t dy = -1; dy <= 1; dy++) {
-            if (dx != 0 || dy != 0) {
-                ili9488::ILI9488_UI::drawString(x + dx, y + dy, str, outline_color, 0, 1);
+                                                 uint16_t color, uint16_t outline_color,
+                                                 uint16_t bg_color) {
+    if (!str) return;
+    int16_t text_w = detail::textLength(str) * font::FONT_WIDTH;
+    if (text_w == 0) return;
+    
+    // Text cells grown by the one-pixel outline, clipped
+    const ClipRect& clip = getClip();
+    int16_t x0 = std::max<int16_t>(x - 1, clip.x0);
+    int16_t y0 = std::max<int16_t>(y - 1, clip.y0);
+    int16_t x1 = std::min<int16_t>(x + text_w + 1, clip.x1);
+    int16_t y1 = std::min<int16_t>(y + font::FONT_HEIGHT + 1, clip.y1);
+    if (x0 >= x1 || y0 >= y1) return;
+    
+    // Masks keep a one-pixel border around the window so glyphs just
+    // outside the clip still outline its edge
+    int16_t w = x1 - x0;
+    int16_t h = y1 - y0;
+    int16_t mw = w + 2;
+    int16_t mh = h + 2;
+    size_t stride = (size_t(mw) + 31) / 32;
+    size_t plane = stride * mh;
+    text_mask_.assign(plane * 2, 0);
+    uint32_t* text = text_mask_.data();
+    uint32_t* outline = text + plane;
+    rasterizeText(text, stride, x0 - 1, y0 - 1, mw, mh, x, y, str);
+    
+    // Dilate: OR each row with its left/right shifts, then with the rows
+    // above and below; the outline is what the text does not cover
+    auto spread = [&](const uint32_t* row, size_t i) -> uint32_t {
+        uint32_t left = (row[i] << 1) | (i + 1 < stride ? row[i + 1] >> 31 : 0);
+        uint32_t right = (row[i] >> 1) | (i > 0 ? row[i - 1] << 31 : 0);
+        return row[i] | left | right;
+    };
+    for (int16_t r = 1; r < mh - 1; ++r) {
+        const uint32_t* above = text + (r - 1) * stride;
+        const uint32_t* row = above + stride;
+        const uint32_t* below = row + stride;
+        uint32_t* out = outline + r * stride;
+        for (size_t i = 0; i < stride; ++i) {
+            out[i] = (spread(above, i) | spread(row, i) | spread(below, i)) & ~row[i];
+        }
+    }
+    
+    writeTextMask(x0, y0, w, h, text + stride, outline + stride, stride, 1,
+                  color, outline_color, bg_color);
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::rasterizeText(uint32_t* mask, size_t stride,
+                                            int16_t mx, int16_t my, int16_t mw, int16_t mh,
+                                            int16_t x, int16_t y, const char* str) const {
+    using namespace font;
+    
+    int16_t row0 = std::max<int16_t>(my - y, 0);
+    int16_t row1 = std::min<int16_t>(my + mh - y, FONT_HEIGHT);
+    int16_t col = x - mx;
+    for (; *str && *str != '\n' && col < mw; ++str, col += FONT_WIDTH) {
+        if (col <= -FONT_WIDTH || *str < 32 || *str > 126) continue;  // Advance only
+        const uint8_t* glyph = get_char_data(*str);
+        
+        // Glyph row bits land at column col: one or two words per row
+        int16_t start = std::max<int16_t>(col, 0);
+        int16_t clip = start - col;
+        size_t word = size_t(start) >> 5;
+        int shift = start & 31;
+        for (int16_t row = row0; row < row1; ++row) {
+            uint32_t bits = uint8_t(glyph[row] << clip);
+            if (!bits) continue;
+            uint32_t* dst = mask + size_t(y + row - my) * stride;
+            dst[word] |= (bits << 24) >> shift;
+            if (shift > 24 && word + 1 < stride) {
+                dst[word + 1] |= bits << (56 - shift);
+            }
+        }
+    }
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::writeTextMask(int16_t x, int16_t y, int16_t w, int16_t h,
+                                            const uint32_t* text, const uint32_t* edge,
+                                            size_t stride, size_t first_bit,
+                                            uint16_t color, uint16_t edge_color, uint16_t bg_color) {
+    driver_.writeMaskPixels(x, y, x + w - 1, y + h - 1, text, edge, stride, first_bit,
+                            color, edge_color, bg_color);
+    
+    if (shadow_) {
+        int16_t x1 = std::min<int16_t>(x + w, shadow_x_ + shadow_w_);
+        int16_t y1 = std::min<int16_t>(y + h, shadow_y_ + shadow_h_);
+        for (int16_t py = std::max(y, shadow_y_); py < y1; ++py) {
+            const uint32_t* text_row = text + size_t(py - y) * stride;
+            const uint32_t* edge_row = edge + size_t(py - y) * stride;
+            for (int16_t px = std::max(x, shadow_x_); px < x1; ++px) {
+                size_t bit = first_bit + size_t(px - x);
+                uint32_t select = 0x80000000u >> (bit & 31);
+                uint16_t c = (text_row[bit >> 5] & select) ? color
+                           : (edge_row[bit >> 5] & select) ? edge_color : bg_color;
+                shadowFill(px, py, 1, 1, c);
             }
         }
     }
-    // Draw main text
-    ili9488::ILI9488_UI::drawString(x, y, str, color, 0, 1);
 }
 
 template<typename Driver>
 void PicoILI9488GFX<Driver>::drawGauge(int16_t x, int16_t y, int16_t radius, 
                                         float value, float min_val, float max_val,
                                         uint16_t color, uint16_t bg_color) {
+    // Values are scaled to Q16 once; the fraction is an integer division
+    using namespace ili9488::fixed;
+    uint32_t fraction = fraction_q16(to_q16(value), to_q16(min_val), to_q16(max_val));
+    drawGaugeFraction(x, y, radius, fraction, color, bg_color);
+}
+
+template<typename Driver>
+void PicoILI9488GFX<Driver>::drawGaugeFraction(int16_t x, int16_t y, int16_t radius,
+                                                uint32_t fraction_q16,
+                                                uint16_t color, uint16_t bg_color) {
+    using namespace ili9488::fixed;
+    
     // Draw gauge background
     ili9488::ILI9488_UI::drawCircle(x, y, radius, bg_color);
     
-    // Calculate angle for value
-    float angle = 3.14159f * (value - min_val) / (max_val - min_val);
-    int16_t end_x = x + static_cast<int16_t>(radius * 0.8f * cos(angle));
-    int16_t end_y = y + static_cast<int16_t>(radius * 0.8f * sin(angle));
+    // Needle sweeps half a turn from the right (min) through the bottom (max)
+    if (fraction_q16 > Q16_ONE) fraction_q16 = Q16_ONE;
+    angle_t angle = lerp_angle(0, ANGLE_HALF, fraction_q16);
+    int16_t end_x, end_y;
+    polar_to_xy(x, y, radius * 4 / 5, angle, end_x, end_y);
     
     // Draw gauge needle
     ili9488::ILI9488_UI::drawLine(x, y, end_x, end_y, color);
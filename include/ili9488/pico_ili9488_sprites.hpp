@@ -0,0 +1,130 @@
+#pragma once
+
+#include <vector>
+#include "pico_ili9488_gfx.hpp"
+
+namespace pico_ili9488_gfx {
+
+/**
+ * @brief Sprite layer over PicoILI9488GFX
+ *
+ * Small RGB565 images (cursor, caret, icons, toasts) that move over
+ * content drawn by the application. Each sprite keeps a copy of the
+ * background under its on-screen bounds, so moving, hiding or changing
+ * its image restores that background without the caller repainting it.
+ *
+ * update() redraws only sprites changed since the last call. A change is
+ * composed off-screen over the union of the old and new bounds (or each
+ * separately when the union would be larger than both) and sent as one
+ * window per rectangle; overlapping sprites are composited in index
+ * order, with an optional color key. Idle frames send nothing.
+ *
+ * Background under new bounds not covered by a sprite comes from
+ * PicoILI9488GFX::readDestination(): the shadow buffer, panel readback,
+ * or the blend background. After repainting under visible sprites, call
+ * invalidate() so they capture the new background.
+ *
+ * @tparam Driver Display driver type used by PicoILI9488GFX
+ * @tparam MaxSprites Sprite capacity
+ */
+template<typename Driver, size_t MaxSprites = 8>
+class PicoILI9488SpriteLayer {
+public:
+    /**
+     * @brief Constructor
+     * @param gfx Graphics layer to draw through
+     */
+    explicit PicoILI9488SpriteLayer(PicoILI9488GFX<Driver>& gfx);
+
+    /**
+     * @brief Add a hidden sprite
+     * @param pixels w x h RGB565 pixels, row-major (caller-owned)
+     * @return Sprite index, or -1 when MaxSprites sprites exist
+     */
+    int addSprite(const uint16_t* pixels, int16_t w, int16_t h);
+
+    /**
+     * @brief Replace the image (same size), e.g. the next animation frame
+     */
+    void setImage(int id, const uint16_t* pixels);
+
+    /**
+     * @brief Treat pixels of this color as transparent
+     */
+    void setColorKey(int id, uint16_t key);
+
+    /**
+     * @brief Draw every pixel of the image
+     */
+    void clearColorKey(int id);
+
+    /**
+     * @brief Move the sprite's top-left corner
+     */
+    void moveTo(int id, int16_t x, int16_t y);
+
+    /**
+     * @brief Show or hide the sprite
+     */
+    void setVisible(int id, bool visible);
+
+    /**
+     * @brief Redraw the sprites changed since the last update()
+     * @return Number of windows sent
+     */
+    size_t update();
+
+    /**
+     * @brief Forget what is on screen
+     * @details For after the application repainted the screen under the
+     *          sprites: visible sprites capture the new background and are
+     *          drawn again on the next update(), old positions are not restored
+     */
+    void invalidate();
+
+private:
+    using Rect = ili9488::ILI9488_UI::ClipRect;
+
+    struct Sprite {
+        const uint16_t* pixels = nullptr;
+        int16_t w = 0, h = 0;
+        int16_t x = 0, y = 0;          ///< Requested position
+        bool visible = false;
+        bool keyed = false;
+        uint16_t key = 0;
+        bool dirty = false;            ///< Changed since the last update()
+        bool shown = false;            ///< Drawn at (shown_x, shown_y)
+        int16_t shown_x = 0, shown_y = 0;
+        std::vector<uint16_t> under;   ///< Background under the shown bounds
+    };
+
+    /**
+     * @brief Sprite bounds at (x, y), clipped to the screen
+     */
+    Rect bounds(const Sprite& sprite, int16_t x, int16_t y) const;
+
+    /**
+     * @brief Move one sprite from its shown state to its requested state
+     */
+    size_t redraw(size_t id);
+
+    /**
+     * @brief Compose and send one dirty rectangle
+     * @param id Sprite being redrawn (drawn at its requested position)
+     * @param capture Whether rect contains the sprite's new bounds
+     */
+    void compose(const Rect& rect, size_t id, bool capture);
+
+    static bool isEmpty(const Rect& r) { return r.x0 >= r.x1 || r.y0 >= r.y1; }
+    static int32_t area(const Rect& r) { return isEmpty(r) ? 0 : int32_t(r.x1 - r.x0) * (r.y1 - r.y0); }
+
+    PicoILI9488GFX<Driver>& gfx_;     ///< Graphics layer
+    Sprite sprites_[MaxSprites];      ///< Sprites, composited in index order
+    size_t count_ = 0;                ///< Sprites added
+    std::vector<uint16_t> compose_;   ///< Dirty rectangle being composed
+};
+
+} // namespace pico_ili9488_gfx
+
+// Include template implementation
+#include "pico_ili9488_sprites.inl"
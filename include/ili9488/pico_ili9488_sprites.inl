@@ -0,0 +1,211 @@
+// Template implementation file for the sprite layer
+// This file should be included at the end of pico_ili9488_sprites.hpp
+
+#include <algorithm>
+
+namespace pico_ili9488_gfx {
+
+template<typename Driver, size_t MaxSprites>
+PicoILI9488SpriteLayer<Driver, MaxSprites>::PicoILI9488SpriteLayer(PicoILI9488GFX<Driver>& gfx)
+    : gfx_(gfx) {
+}
+
+template<typename Driver, size_t MaxSprites>
+int PicoILI9488SpriteLayer<Driver, MaxSprites>::addSprite(const uint16_t* pixels, int16_t w, int16_t h) {
+    if (count_ == MaxSprites || w <= 0 || h <= 0) return -1;
+
+    Sprite& sprite = sprites_[count_];
+    sprite = Sprite{};
+    sprite.pixels = pixels;
+    sprite.w = w;
+    sprite.h = h;
+    sprite.under.resize(size_t(w) * h);
+
+    // A dirty rectangle never exceeds old + new bounds
+    if (compose_.size() < size_t(w) * h * 2) {
+        compose_.resize(size_t(w) * h * 2);
+    }
+    return static_cast<int>(count_++);
+}
+
+template<typename Driver, size_t MaxSprites>
+void PicoILI9488SpriteLayer<Driver, MaxSprites>::setImage(int id, const uint16_t* pixels) {
+    Sprite& sprite = sprites_[id];
+    if (sprite.pixels == pixels) return;
+    sprite.pixels = pixels;
+    sprite.dirty = true;
+}
+
+template<typename Driver, size_t MaxSprites>
+void PicoILI9488SpriteLayer<Driver, MaxSprites>::setColorKey(int id, uint16_t key) {
+    Sprite& sprite = sprites_[id];
+    if (sprite.keyed && sprite.key == key) return;
+    sprite.keyed = true;
+    sprite.key = key;
+    sprite.dirty = true;
+}
+
+template<typename Driver, size_t MaxSprites>
+void PicoILI9488SpriteLayer<Driver, MaxSprites>::clearColorKey(int id) {
+    Sprite& sprite = sprites_[id];
+    if (!sprite.keyed) return;
+    sprite.keyed = false;
+    sprite.dirty = true;
+}
+
+template<typename Driver, size_t MaxSprites>
+void PicoILI9488SpriteLayer<Driver, MaxSprites>::moveTo(int id, int16_t x, int16_t y) {
+    Sprite& sprite = sprites_[id];
+    if (sprite.x == x && sprite.y == y) return;
+    sprite.x = x;
+    sprite.y = y;
+    sprite.dirty = true;
+}
+
+template<typename Driver, size_t MaxSprites>
+void PicoILI9488SpriteLayer<Driver, MaxSprites>::setVisible(int id, bool visible) {
+    Sprite& sprite = sprites_[id];
+    if (sprite.visible == visible) return;
+    sprite.visible = visible;
+    sprite.dirty = true;
+}
+
+template<typename Driver, size_t MaxSprites>
+size_t PicoILI9488SpriteLayer<Driver, MaxSprites>::update() {
+    size_t windows = 0;
+    for (size_t i = 0; i < count_; ++i) {
+        if (sprites_[i].dirty) {
+            windows += redraw(i);
+            sprites_[i].dirty = false;
+        }
+    }
+    return windows;
+}
+
+template<typename Driver, size_t MaxSprites>
+void PicoILI9488SpriteLayer<Driver, MaxSprites>::invalidate() {
+    for (size_t i = 0; i < count_; ++i) {
+        sprites_[i].shown = false;
+        sprites_[i].dirty = sprites_[i].visible;
+    }
+}
+
+template<typename Driver, size_t MaxSprites>
+typename PicoILI9488SpriteLayer<Driver, MaxSprites>::Rect
+PicoILI9488SpriteLayer<Driver, MaxSprites>::bounds(const Sprite& sprite, int16_t x, int16_t y) const {
+    Rect r;
+    r.x0 = std::max<int16_t>(x, 0);
+    r.y0 = std::max<int16_t>(y, 0);
+    r.x1 = static_cast<int16_t>(std::min<int32_t>(int32_t(x) + sprite.w, gfx_.width()));
+    r.y1 = static_cast<int16_t>(std::min<int32_t>(int32_t(y) + sprite.h, gfx_.height()));
+    return r;
+}
+
+template<typename Driver, size_t MaxSprites>
+size_t PicoILI9488SpriteLayer<Driver, MaxSprites>::redraw(size_t id) {
+    Sprite& sprite = sprites_[id];
+    const Rect none{0, 0, 0, 0};
+    Rect old_rect = sprite.shown ? bounds(sprite, sprite.shown_x, sprite.shown_y) : none;
+    Rect new_rect = (sprite.visible && sprite.pixels) ? bounds(sprite, sprite.x, sprite.y) : none;
+
+    size_t windows = 0;
+    if (!isEmpty(old_rect) && !isEmpty(new_rect)) {
+        Rect both{std::min(old_rect.x0, new_rect.x0), std::min(old_rect.y0, new_rect.y0),
+                  std::max(old_rect.x1, new_rect.x1), std::max(old_rect.y1, new_rect.y1)};
+        if (area(both) > area(old_rect) + area(new_rect)) {
+            // Far apart: restoring and drawing separately sends less
+            compose(old_rect, id, false);
+            compose(new_rect, id, true);
+            windows = 2;
+        } else {
+            compose(both, id, true);
+            windows = 1;
+        }
+    } else if (!isEmpty(old_rect)) {
+        compose(old_rect, id, false);
+        windows = 1;
+    } else if (!isEmpty(new_rect)) {
+        compose(new_rect, id, true);
+        windows = 1;
+    }
+
+    sprite.shown = !isEmpty(new_rect);
+    sprite.shown_x = sprite.x;
+    sprite.shown_y = sprite.y;
+    return windows;
+}
+
+template<typename Driver, size_t MaxSprites>
+void PicoILI9488SpriteLayer<Driver, MaxSprites>::compose(const Rect& rect, size_t id, bool capture) {
+    const int16_t w = rect.x1 - rect.x0;
+    const int16_t h = rect.y1 - rect.y0;
+    if (compose_.size() < size_t(w) * h) {
+        compose_.resize(size_t(w) * h);
+    }
+    uint16_t* buffer = compose_.data();
+
+    // Background: screen content, except where a sprite is shown, whose
+    // saved copy is used instead. Skip the read when one sprite covers it all.
+    bool covered = false;
+    for (size_t i = 0; i < count_ && !covered; ++i) {
+        const Sprite& s = sprites_[i];
+        if (!s.shown) continue;
+        Rect b = bounds(s, s.shown_x, s.shown_y);
+        covered = b.x0 <= rect.x0 && b.y0 <= rect.y0 && b.x1 >= rect.x1 && b.y1 >= rect.y1;
+    }
+    if (!covered) {
+        gfx_.readDestination(rect.x0, rect.y0, w, h, buffer);
+    }
+    for (size_t i = 0; i < count_; ++i) {
+        const Sprite& s = sprites_[i];
+        if (!s.shown) continue;
+        Rect b = bounds(s, s.shown_x, s.shown_y);
+        int16_t x0 = std::max(b.x0, rect.x0), x1 = std::min(b.x1, rect.x1);
+        int16_t y0 = std::max(b.y0, rect.y0), y1 = std::min(b.y1, rect.y1);
+        if (x0 >= x1 || y0 >= y1) continue;
+        for (int16_t y = y0; y < y1; ++y) {
+            const uint16_t* src = s.under.data() + size_t(y - s.shown_y) * s.w + (x0 - s.shown_x);
+            std::copy(src, src + (x1 - x0), buffer + size_t(y - rect.y0) * w + (x0 - rect.x0));
+        }
+    }
+
+    // New saved copy for the sprite being redrawn (its bounds lie in rect)
+    if (capture) {
+        Sprite& s = sprites_[id];
+        Rect b = bounds(s, s.x, s.y);
+        for (int16_t y = b.y0; y < b.y1; ++y) {
+            const uint16_t* src = buffer + size_t(y - rect.y0) * w + (b.x0 - rect.x0);
+            std::copy(src, src + (b.x1 - b.x0), s.under.data() + size_t(y - s.y) * s.w + (b.x0 - s.x));
+        }
+    }
+
+    // Sprites on top in index order; the redrawn one at its new position
+    for (size_t i = 0; i < count_; ++i) {
+        const Sprite& s = sprites_[i];
+        int16_t sx = s.shown_x, sy = s.shown_y;
+        bool draw = s.shown;
+        if (i == id) {
+            sx = s.x;
+            sy = s.y;
+            draw = s.visible && s.pixels;
+        }
+        if (!draw) continue;
+
+        Rect b = bounds(s, sx, sy);
+        int16_t x0 = std::max(b.x0, rect.x0), x1 = std::min(b.x1, rect.x1);
+        int16_t y0 = std::max(b.y0, rect.y0), y1 = std::min(b.y1, rect.y1);
+        for (int16_t y = y0; y < y1; ++y) {
+            const uint16_t* src = s.pixels + size_t(y - sy) * s.w + (x0 - sx);
+            uint16_t* dst = buffer + size_t(y - rect.y0) * w + (x0 - rect.x0);
+            for (int16_t x = 0; x < x1 - x0; ++x) {
+                if (!s.keyed || src[x] != s.key) {
+                    dst[x] = src[x];
+                }
+            }
+        }
+    }
+
+    gfx_.drawBitmapFast(rect.x0, rect.y0, w, h, buffer);
+}
+
+} // namespace pico_ili9488_gfx
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "pico_ili9488_gfx.hpp"
+#include "ili9488_fixed_math.hpp"
+
+namespace pico_ili9488_gfx {
+
+/**
+ * @brief Retained-state progress bar
+ *
+ * Remembers the filled width from the last update and repaints only the
+ * strip between the old and new widths, so a telemetry-driven bar costs
+ * a few columns per update instead of the whole widget.
+ *
+ * @tparam Driver Display driver type used by PicoILI9488GFX
+ */
+template<typename Driver>
+class PicoILI9488ProgressBar {
+public:
+    /**
+     * @brief Constructor (nothing is drawn until draw() or update())
+     * @param gfx Graphics layer to draw through
+     * @param fg_color Filled part color (RGB565)
+     * @param bg_color Empty part color (RGB565)
+     */
+    PicoILI9488ProgressBar(PicoILI9488GFX<Driver>& gfx, int16_t x, int16_t y, int16_t w, int16_t h,
+                           uint16_t fg_color, uint16_t bg_color);
+
+    /**
+     * @brief Repaint the whole bar at progress (0-100, clamped)
+     */
+    void draw(uint8_t progress);
+
+    /**
+     * @brief Move the bar to progress, repainting only the changed strip
+     * @details Falls back to draw() after construction or invalidate()
+     */
+    void update(uint8_t progress);
+
+    /**
+     * @brief Forget the on-screen state; the next update() repaints fully
+     */
+    void invalidate();
+
+    /**
+     * @brief Last progress value passed to draw() or update()
+     */
+    uint8_t value() const;
+
+private:
+    /**
+     * @brief Filled width in pixels for progress
+     */
+    int16_t fillWidth(uint8_t progress) const;
+
+    PicoILI9488GFX<Driver>& gfx_;  ///< Graphics layer
+    int16_t x_, y_, w_, h_;        ///< Widget bounds
+    uint16_t fg_color_;            ///< Filled part color
+    uint16_t bg_color_;            ///< Empty part color
+    uint8_t value_ = 0;            ///< Last progress value
+    int16_t filled_ = -1;          ///< Filled width on screen, -1 if unknown
+};
+
+/**
+ * @brief Retained-state gauge
+ *
+ * Same geometry as PicoILI9488GFX::drawGaugeFraction() (needle sweeps half
+ * a turn from the right through the bottom). update() erases the previous
+ * needle with the face color and draws the new one; the dial is only
+ * painted by draw().
+ *
+ * @tparam Driver Display driver type used by PicoILI9488GFX
+ */
+template<typename Driver>
+class PicoILI9488Gauge {
+public:
+    /**
+     * @brief Constructor (nothing is drawn until draw() or update())
+     * @param gfx Graphics layer to draw through
+     * @param needle_color Needle color (RGB565)
+     * @param dial_color Dial outline color (RGB565)
+     * @param face_color Face color, used to erase the old needle (RGB565)
+     */
+    PicoILI9488Gauge(PicoILI9488GFX<Driver>& gfx, int16_t x, int16_t y, int16_t radius,
+                     uint16_t needle_color, uint16_t dial_color, uint16_t face_color);
+
+    /**
+     * @brief Set the value range mapped onto the dial (default 0-100)
+     */
+    void setRange(int32_t min_val, int32_t max_val);
+
+    /**
+     * @brief Repaint face, dial and needle at value
+     */
+    void draw(int32_t value);
+
+    /**
+     * @brief Move the needle to value, erasing only the old needle
+     * @details No-op when the needle end point does not move; falls back
+     *          to draw() after construction or invalidate()
+     */
+    void update(int32_t value);
+
+    /**
+     * @brief Forget the on-screen state; the next update() repaints fully
+     */
+    void invalidate();
+
+    /**
+     * @brief Last value passed to draw() or update()
+     */
+    int32_t value() const;
+
+private:
+    /**
+     * @brief Needle end point for value
+     */
+    void needleEnd(int32_t value, int16_t& end_x, int16_t& end_y) const;
+
+    PicoILI9488GFX<Driver>& gfx_;  ///< Graphics layer
+    int16_t x_, y_, radius_;       ///< Dial center and radius
+    uint16_t needle_color_;        ///< Needle color
+    uint16_t dial_color_;          ///< Dial outline color
+    uint16_t face_color_;          ///< Face (erase) color
+    int32_t min_val_ = 0;          ///< Value at the right end of the sweep
+    int32_t max_val_ = 100;        ///< Value at the left end of the sweep
+    int32_t value_ = 0;            ///< Last value
+    int16_t needle_x_ = 0;         ///< Needle end on screen
+    int16_t needle_y_ = 0;
+    bool drawn_ = false;           ///< Whether the needle position is known
+};
+
+} // namespace pico_ili9488_gfx
+
+// Include template implementation
+#include "pico_ili9488_widgets.inl"
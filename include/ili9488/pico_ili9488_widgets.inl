@@ -0,0 +1,126 @@
+// Template implementation file for the retained-state widgets
+// This file should be included at the end of pico_ili9488_widgets.hpp
+
+namespace pico_ili9488_gfx {
+
+// === PicoILI9488ProgressBar ===
+
+template<typename Driver>
+PicoILI9488ProgressBar<Driver>::PicoILI9488ProgressBar(PicoILI9488GFX<Driver>& gfx,
+                                                       int16_t x, int16_t y, int16_t w, int16_t h,
+                                                       uint16_t fg_color, uint16_t bg_color)
+    : gfx_(gfx), x_(x), y_(y), w_(w), h_(h), fg_color_(fg_color), bg_color_(bg_color) {
+}
+
+template<typename Driver>
+void PicoILI9488ProgressBar<Driver>::draw(uint8_t progress) {
+    value_ = progress;
+    filled_ = fillWidth(progress);
+    gfx_.fillRect(x_, y_, filled_, h_, fg_color_);
+    gfx_.fillRect(x_ + filled_, y_, w_ - filled_, h_, bg_color_);
+}
+
+template<typename Driver>
+void PicoILI9488ProgressBar<Driver>::update(uint8_t progress) {
+    if (filled_ < 0) {
+        draw(progress);
+        return;
+    }
+
+    value_ = progress;
+    int16_t filled = fillWidth(progress);
+    if (filled > filled_) {
+        gfx_.fillRect(x_ + filled_, y_, filled - filled_, h_, fg_color_);
+    } else if (filled < filled_) {
+        gfx_.fillRect(x_ + filled, y_, filled_ - filled, h_, bg_color_);
+    }
+    filled_ = filled;
+}
+
+template<typename Driver>
+void PicoILI9488ProgressBar<Driver>::invalidate() {
+    filled_ = -1;
+}
+
+template<typename Driver>
+uint8_t PicoILI9488ProgressBar<Driver>::value() const {
+    return value_;
+}
+
+template<typename Driver>
+int16_t PicoILI9488ProgressBar<Driver>::fillWidth(uint8_t progress) const {
+    // Same rounding as PicoILI9488GFX::drawProgressBar()
+    return static_cast<int16_t>(
+        ili9488::fixed::lerp(0, w_, ili9488::fixed::fraction_q16(progress, 0, 100)));
+}
+
+// === PicoILI9488Gauge ===
+
+template<typename Driver>
+PicoILI9488Gauge<Driver>::PicoILI9488Gauge(PicoILI9488GFX<Driver>& gfx,
+                                           int16_t x, int16_t y, int16_t radius,
+                                           uint16_t needle_color, uint16_t dial_color,
+                                           uint16_t face_color)
+    : gfx_(gfx), x_(x), y_(y), radius_(radius),
+      needle_color_(needle_color), dial_color_(dial_color), face_color_(face_color) {
+}
+
+template<typename Driver>
+void PicoILI9488Gauge<Driver>::setRange(int32_t min_val, int32_t max_val) {
+    min_val_ = min_val;
+    max_val_ = max_val;
+    drawn_ = false;  // Needle position no longer matches the stored value
+}
+
+template<typename Driver>
+void PicoILI9488Gauge<Driver>::draw(int32_t value) {
+    gfx_.fillCircle(x_, y_, radius_, face_color_);
+    gfx_.drawCircle(x_, y_, radius_, dial_color_);
+
+    value_ = value;
+    needleEnd(value, needle_x_, needle_y_);
+    gfx_.drawLine(x_, y_, needle_x_, needle_y_, needle_color_);
+    drawn_ = true;
+}
+
+template<typename Driver>
+void PicoILI9488Gauge<Driver>::update(int32_t value) {
+    if (!drawn_) {
+        draw(value);
+        return;
+    }
+
+    value_ = value;
+    int16_t end_x, end_y;
+    needleEnd(value, end_x, end_y);
+    if (end_x == needle_x_ && end_y == needle_y_) {
+        return;
+    }
+
+    // Erase the old needle, then draw the new one over the shared hub pixel
+    gfx_.drawLine(x_, y_, needle_x_, needle_y_, face_color_);
+    gfx_.drawLine(x_, y_, end_x, end_y, needle_color_);
+    needle_x_ = end_x;
+    needle_y_ = end_y;
+}
+
+template<typename Driver>
+void PicoILI9488Gauge<Driver>::invalidate() {
+    drawn_ = false;
+}
+
+template<typename Driver>
+int32_t PicoILI9488Gauge<Driver>::value() const {
+    return value_;
+}
+
+template<typename Driver>
+void PicoILI9488Gauge<Driver>::needleEnd(int32_t value, int16_t& end_x, int16_t& end_y) const {
+    using namespace ili9488::fixed;
+
+    // Same geometry as PicoILI9488GFX::drawGaugeFraction()
+    angle_t angle = lerp_angle(0, ANGLE_HALF, fraction_q16(value, min_val_, max_val_));
+    polar_to_xy(x_, y_, radius_ * 4 / 5, angle, end_x, end_y);
+}
+
+} // namespace pico_ili9488_gfx
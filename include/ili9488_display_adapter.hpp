@@ -0,0 +1,122 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <cstdint>
+#include "display_driver.hpp"
+#include "ili9488_framebuffer.hpp"
+#include "ili9488/ili9488_driver.hpp"
+#include "ili9488/pico_ili9488_gfx.hpp"
+#include "ili9488/ili9488_colors.hpp"
+
+namespace usb2ttl {
+
+/**
+ * @brief ILI9488显示驱动适配器
+ * @details 将ILI9488Driver封装为DisplayDriver接口，供TextEditor等模块使用
+ * 引脚配置来自pin_config::ILI9488Config
+ */
+class ILI9488DisplayAdapter : public DisplayDriver {
+public:
+    using GFX = pico_ili9488_gfx::PicoILI9488GFX<ili9488::ILI9488Driver>;
+    
+    /// 屏幕底部状态栏高度（像素），不参与文本区域和滚动
+    static constexpr int STATUS_BAR_HEIGHT = 30;
+    
+    /**
+     * @brief 构造函数，按统一引脚配置创建驱动和图形库实例
+     */
+    ILI9488DisplayAdapter();
+    
+    bool initialize() override;
+    void clear_screen(std::uint32_t color = ili9488_colors::rgb666::BLACK) override;
+    void fill_rect(int x, int y, int width, int height, std::uint32_t color) override;
+    void draw_text(const std::string& text, int x, int y, 
+                   std::uint32_t fg_color = ili9488_colors::rgb666::WHITE, 
+                   std::uint32_t bg_color = ili9488_colors::rgb666::BLACK) override;
+    void set_backlight(float brightness) override;
+    void refresh() override;
+    
+    int get_width() const override;
+    int get_height() const override;
+    int get_font_width() const override;
+    int get_font_height() const override;
+    int get_max_text_rows() const override;
+    
+    /**
+     * @brief 使用ILI9488硬件垂直滚动移动文本区域
+     * @details 只发送一次VSCRSADD命令，绘制坐标在内部映射到显存行，
+     * 调用者继续使用屏幕坐标重绘新露出的行
+     */
+    bool scroll_text_rows(int rows) override;
+    
+    /**
+     * @brief 绘制单个字符
+     */
+    void draw_char(char ch, int x, int y, 
+                   std::uint32_t fg_color = ili9488_colors::rgb666::WHITE, 
+                   std::uint32_t bg_color = ili9488_colors::rgb666::BLACK);
+    
+    /**
+     * @brief 绘制矩形边框
+     */
+    void draw_rect(int x, int y, int width, int height, std::uint32_t color);
+    
+    /**
+     * @brief 启用/关闭离屏帧缓冲
+     * @details 启用后fill_rect/draw_text/draw_char/draw_rect只写入帧缓冲，
+     * 由refresh()发送脏块；启用时清屏为黑色，关闭时先发送剩余脏块。
+     * 通过getGFX()/getDriver()直接绘制的内容不经过帧缓冲
+     */
+    void enable_framebuffer(bool enable);
+    
+    /**
+     * @brief 是否启用了帧缓冲
+     */
+    bool has_framebuffer() const { return framebuffer_ != nullptr; }
+    
+    /**
+     * @brief 获取最近一次refresh()的帧缓冲统计
+     */
+    const ILI9488Framebuffer::FlushStats& get_last_flush_stats() const { return last_flush_; }
+    
+    /**
+     * @brief 获取图形库实例
+     */
+    GFX* getGFX() { return gfx_.get(); }
+    
+    /**
+     * @brief 获取底层ILI9488驱动
+     */
+    ili9488::ILI9488Driver& getDriver() { return *ili9488_driver_; }
+
+private:
+    /**
+     * @brief 将屏幕坐标的矩形映射到显存行后填充（跨越滚动回绕处时拆成两块）
+     */
+    void fill_scrolled_rect(int x, int y, int width, int height, std::uint32_t color);
+    
+    /**
+     * @brief 按显存坐标填充：写入帧缓冲或直接发送到屏幕
+     */
+    void fill_memory_rect(int x, int y, int width, int height, std::uint32_t color);
+    
+    /**
+     * @brief 文本区域的硬件滚动区是否有效
+     * @details 旋转会在驱动中复位滚动区，因此不缓存结果而是每次查询驱动；
+     *          区域已失效时按初始化参数重新建立（偏移为0，与屏幕内容一致），
+     *          横屏下无法建立时返回false
+     */
+    bool text_scroll_active();
+    
+    std::unique_ptr<ili9488::ILI9488Driver> ili9488_driver_;
+    std::unique_ptr<GFX> gfx_;
+    
+    int scroll_top_ = 0;       ///< 滚动区域起始行（像素）
+    int scroll_height_ = 0;    ///< 滚动区域高度（像素，字体高度的整数倍）
+    
+    std::unique_ptr<ILI9488Framebuffer> framebuffer_;  ///< 可选帧缓冲（显存坐标）
+    ILI9488Framebuffer::FlushStats last_flush_;
+};
+
+} // namespace usb2ttl
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ili9488/ili9488_driver.hpp"
+#include "ili9488/ili9488_colors.hpp"
+
+namespace usb2ttl {
+
+/**
+ * @brief ILI9488离屏帧缓冲（4位调色板 + 脏块位图）
+ * @details 每像素4位，最多16种颜色，320x480约75KB。绘制只写内存，
+ * 像素值实际改变时才标记所在的16x16块为脏块；flush()把每行相邻的脏块
+ * 合并为一个窗口，通过驱动的DMA像素流水线发送。同一帧内的重复绘制
+ * 以及与屏幕内容相同的绘制都不产生SPI流量。
+ * 坐标为显存坐标（已经过硬件滚动映射）。
+ */
+class ILI9488Framebuffer {
+public:
+    static constexpr int TILE_SIZE = 16;       ///< 脏块边长（像素）
+    static constexpr int PALETTE_SIZE = 16;    ///< 调色板容量
+
+    /**
+     * @brief 一次flush的统计
+     */
+    struct FlushStats {
+        std::uint32_t bytes_drawn = 0;  ///< 立即模式下这些绘制会发送的像素字节数
+        std::uint32_t bytes_sent = 0;   ///< 实际发送的像素字节数
+        std::uint32_t tiles_sent = 0;   ///< 发送的脏块数
+        std::uint32_t windows = 0;      ///< 发送的窗口数（合并后的脏块行段）
+    };
+
+    /**
+     * @brief 构造函数
+     * @param width 宽度（像素）
+     * @param height 高度（像素）
+     */
+    ILI9488Framebuffer(int width, int height);
+
+    /**
+     * @brief 用单色清空缓冲并重置调色板
+     * @note 不标记脏块，调用者需同时用区域填充清屏
+     */
+    void clear(std::uint32_t color);
+
+    /**
+     * @brief 填充矩形（RGB666颜色，自动裁剪）
+     */
+    void fill_rect(int x, int y, int width, int height, std::uint32_t color);
+
+    /**
+     * @brief 绘制文本（8x16字体，不可打印字符只前进光标）
+     */
+    void draw_text(const std::string& text, int x, int y,
+                   std::uint32_t fg_color, std::uint32_t bg_color);
+
+    /**
+     * @brief 绘制单个字符
+     */
+    void draw_char(char ch, int x, int y, std::uint32_t fg_color, std::uint32_t bg_color);
+
+    /**
+     * @brief 是否有待发送的脏块
+     */
+    bool is_dirty() const;
+
+    /**
+     * @brief 将所有块标记为脏（屏幕内容被其他途径覆盖后使用）
+     */
+    void mark_all_dirty();
+
+    /**
+     * @brief 发送所有脏块并清除脏标记
+     * @return 本帧（上次flush以来）的统计
+     */
+    FlushStats flush(ili9488::ILI9488Driver& driver);
+
+    int get_width() const { return width_; }
+    int get_height() const { return height_; }
+
+private:
+    std::uint8_t palette_index(std::uint32_t color);
+    void set_pixel(int x, int y, std::uint8_t index);
+    void mark_tile(int tx, int ty);
+    bool is_tile_dirty(int tx, int ty) const;
+
+    int width_;
+    int height_;
+    int tiles_x_;
+    int tiles_y_;
+
+    std::vector<std::uint8_t> pixels_;        ///< 每字节2像素，偶数x在高4位
+    std::vector<std::uint32_t> dirty_;        ///< 脏块位图
+    std::uint32_t palette_[PALETTE_SIZE];     ///< 调色板（RGB666，0xRRGGBB字节对齐）
+    int palette_size_ = 0;
+
+    std::uint32_t bytes_drawn_ = 0;           ///< 本帧绘制量统计
+};
+
+} // namespace usb2ttl
@@ -42,7 +42,8 @@ namespace pin_config {
         constexpr std::uint8_t PIN_RST = 15;   ///< 重置信号
         constexpr std::uint8_t PIN_BL = 16;    ///< 背光控制（仅部分显示屏使用）
         constexpr std::uint8_t PIN_LED = 25;   ///< LED指示灯
-        constexpr std::uint8_t PIN_TE = 21;    ///< 撕裂效应信号（保留接口）
+        constexpr std::uint8_t PIN_TE = 21;    ///< 撕裂效应信号（可选，用于TE同步刷新）
+        constexpr std::uint8_t PIN_MISO = 255; ///< SPI读数据线（可选，接面板SDO用于回读，可用GPIO 4；255=未连接）
     }
     
     // =================================================================
@@ -90,6 +91,8 @@ namespace pin_config {
         static constexpr std::uint8_t pin_dc = display_spi_pins::PIN_DC;
         static constexpr std::uint8_t pin_rst = display_spi_pins::PIN_RST;
         static constexpr std::uint8_t pin_bl = display_spi_pins::PIN_BL;  // 背光控制
+        static constexpr std::uint8_t pin_te = display_spi_pins::PIN_TE;  // TE同步（可选）
+        static constexpr std::uint8_t pin_miso = display_spi_pins::PIN_MISO;  // 显存回读（可选，255=未连接）
         
         // UART接口配置
         static uart_inst_t* uart_instance() { return uart_config::get_uart_instance(); }
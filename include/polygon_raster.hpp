@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace polygon_raster {
+
+/**
+ * @brief Scanline polygon filler shared by the ILI9488 and ST73XX UI cores
+ *
+ * Builds an edge table sorted by top row, then walks the scanlines with an
+ * active edge list kept in x order. Edges are added when the scanline
+ * reaches their top and dropped at their bottom; the list is re-sorted with
+ * an insertion sort, which is linear in practice because edges rarely swap
+ * between neighbouring rows. Each pair of crossings becomes one horizontal
+ * span (even-odd rule), handed to the back end's span writer.
+ *
+ * Edge x positions step exactly in integers (quotient and remainder per
+ * row), giving x1 + (y - y1) * (x2 - x1) / (y2 - y1) truncated toward zero
+ * without floating point. Edges cover rows y_top <= y < y_bottom, so
+ * shared vertices are counted once and the bottom row of the polygon is
+ * left open.
+ *
+ * All storage lives in the object: no heap allocation. fill_polygon()
+ * picks a stack or heap instance by vertex count.
+ *
+ * @tparam Capacity Maximum number of vertices (at most 256: active edges
+ *                  are kept as uint8_t indices)
+ */
+template<size_t Capacity = 32>
+class Rasterizer {
+    static_assert(Capacity <= 256, "active edges are uint8_t indices");
+
+public:
+    static constexpr size_t CAPACITY = Capacity;
+
+    /**
+     * @brief Fill a polygon
+     * @param vx, vy Vertex coordinates
+     * @param count Number of vertices (at least 3)
+     * @param y_min, y_max Rows to rasterize, [y_min, y_max) (the caller's clip)
+     * @param span Called as span(y, x_left, x_right) with inclusive, unclipped x
+     * @return false when count exceeds Capacity (nothing is emitted)
+     */
+    template<typename Span>
+    bool fill(const int16_t* vx, const int16_t* vy, size_t count,
+              int16_t y_min, int16_t y_max, Span&& span);
+
+private:
+    struct Edge {
+        int16_t y_top;     ///< First row covered
+        int16_t y_bottom;  ///< First row past the edge
+        int16_t x;         ///< floor(x) on the current row
+        int16_t step;      ///< floor(dx / dy)
+        int32_t rem;       ///< Current remainder, 0 <= rem < dy
+        int32_t rem_step;  ///< dx mod dy
+        int32_t dy;        ///< y_bottom - y_top (> 0)
+    };
+
+    /**
+     * @brief Position an edge on row y
+     */
+    static void seek(Edge& edge, int16_t x_top, int32_t dx, int16_t y);
+
+    /**
+     * @brief Advance an edge by one row
+     */
+    static void step(Edge& edge);
+
+    /**
+     * @brief Crossing column: current x truncated toward zero
+     */
+    static int16_t crossing(const Edge& edge);
+
+    Edge edges_[Capacity];      ///< Edge table, sorted by y_top
+    int16_t x_top_[Capacity];   ///< Top x of each edge, until it is activated
+    int32_t dx_[Capacity];      ///< x extent of each edge, signed
+    uint8_t active_[Capacity];  ///< Active edges, sorted by crossing
+};
+
+constexpr size_t MAX_VERTICES = 255;  ///< Largest uint8_t vertex count
+
+/**
+ * @brief Fill a polygon of up to MAX_VERTICES vertices
+ * @details Polygons that fit Rasterizer<> use one on the stack (under 1 KB);
+ *          larger ones use a heap Rasterizer<MAX_VERTICES> (about 7 KB) for
+ *          the duration of the call. Same parameters as Rasterizer::fill().
+ * @return false when count exceeds MAX_VERTICES (nothing is emitted)
+ */
+template<typename Span>
+bool fill_polygon(const int16_t* vx, const int16_t* vy, size_t count,
+                  int16_t y_min, int16_t y_max, Span&& span) {
+    if (count <= Rasterizer<>::CAPACITY) {
+        Rasterizer<> raster;
+        return raster.fill(vx, vy, count, y_min, y_max, span);
+    }
+    if (count > MAX_VERTICES) return false;
+    auto raster = std::make_unique<Rasterizer<MAX_VERTICES>>();
+    return raster->fill(vx, vy, count, y_min, y_max, span);
+}
+
+// === Template Method Implementations ===
+
+template<size_t Capacity>
+template<typename Span>
+bool Rasterizer<Capacity>::fill(const int16_t* vx, const int16_t* vy, size_t count,
+                                int16_t y_min, int16_t y_max, Span&& span) {
+    if (count < 3) return true;
+    if (count > Capacity) return false;
+
+    // Edge table: skip horizontal edges, orient top to bottom, insertion
+    // sort by top row. x_top_/dx_ are kept aside until an edge is activated.
+    size_t edge_count = 0;
+    for (size_t i = 0, j = count - 1; i < count; j = i++) {
+        if (vy[i] == vy[j]) continue;
+        bool down = vy[i] < vy[j];
+        Edge edge{};
+        edge.y_top = down ? vy[i] : vy[j];
+        edge.y_bottom = down ? vy[j] : vy[i];
+        int16_t top_x = down ? vx[i] : vx[j];
+        int32_t delta = down ? int32_t(vx[j]) - vx[i] : int32_t(vx[i]) - vx[j];
+
+        size_t k = edge_count++;
+        for (; k > 0 && edges_[k - 1].y_top > edge.y_top; --k) {
+            edges_[k] = edges_[k - 1];
+            x_top_[k] = x_top_[k - 1];
+            dx_[k] = dx_[k - 1];
+        }
+        edges_[k] = edge;
+        x_top_[k] = top_x;
+        dx_[k] = delta;
+    }
+    if (edge_count == 0) return true;
+
+    int16_t y = edges_[0].y_top < y_min ? y_min : edges_[0].y_top;
+    size_t next = 0;
+    size_t active = 0;
+    for (; y < y_max; ++y) {
+        // Drop finished edges and step the rest to this row
+        size_t kept = 0;
+        for (size_t i = 0; i < active; ++i) {
+            Edge& edge = edges_[active_[i]];
+            if (edge.y_bottom <= y) continue;
+            step(edge);
+            active_[kept++] = active_[i];
+        }
+        active = kept;
+
+        // Activate edges starting at (or, after clipping, above) this row
+        for (; next < edge_count && edges_[next].y_top <= y; ++next) {
+            if (edges_[next].y_bottom <= y) continue;
+            seek(edges_[next], x_top_[next], dx_[next], y);
+            active_[active++] = static_cast<uint8_t>(next);
+        }
+        if (active == 0) {
+            if (next == edge_count) break;  // Nothing left below
+            continue;
+        }
+
+        // Keep the active list in crossing order
+        for (size_t i = 1; i < active; ++i) {
+            uint8_t index = active_[i];
+            int16_t x = crossing(edges_[index]);
+            size_t k = i;
+            for (; k > 0 && crossing(edges_[active_[k - 1]]) > x; --k) {
+                active_[k] = active_[k - 1];
+            }
+            active_[k] = index;
+        }
+
+        for (size_t i = 0; i + 1 < active; i += 2) {
+            span(y, crossing(edges_[active_[i]]), crossing(edges_[active_[i + 1]]));
+        }
+    }
+    return true;
+}
+
+template<size_t Capacity>
+void Rasterizer<Capacity>::seek(Edge& edge, int16_t x_top, int32_t dx, int16_t y) {
+    edge.dy = int32_t(edge.y_bottom) - edge.y_top;
+
+    // Floor division of dx by dy and of the offset into the edge
+    int32_t q = dx / edge.dy;
+    int32_t r = dx % edge.dy;
+    if (r < 0) {
+        r += edge.dy;
+        --q;
+    }
+    edge.step = static_cast<int16_t>(q);
+    edge.rem_step = r;
+
+    int64_t offset = int64_t(int32_t(y) - edge.y_top) * dx;
+    q = static_cast<int32_t>(offset / edge.dy);
+    r = static_cast<int32_t>(offset % edge.dy);
+    if (r < 0) {
+        r += edge.dy;
+        --q;
+    }
+    edge.x = static_cast<int16_t>(x_top + q);
+    edge.rem = r;
+}
+
+template<size_t Capacity>
+inline void Rasterizer<Capacity>::step(Edge& edge) {
+    edge.x += edge.step;
+    edge.rem += edge.rem_step;
+    if (edge.rem >= edge.dy) {
+        edge.rem -= edge.dy;
+        ++edge.x;
+    }
+}
+
+template<size_t Capacity>
+inline int16_t Rasterizer<Capacity>::crossing(const Edge& edge) {
+    return (edge.x < 0 && edge.rem != 0) ? int16_t(edge.x + 1) : edge.x;
+}
+
+} // namespace polygon_raster
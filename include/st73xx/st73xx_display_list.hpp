@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include "st73xx_ui.hpp"
+#include "st73xx_font.hpp"
+
+/**
+ * @brief display_list::DisplayList 在 ST73XX_UI 上的回放目标
+ *
+ * 图形经 ST73XX_UI 绘制到驱动缓冲区；文本按 8x16 字库逐像素写入前景/背景色
+ * （ST73XX_UI::drawChar 只画占位块），与驱动的 drawString 字形一致。
+ * 位图逐像素写入，颜色由 writePoint 转换为单色或灰度。
+ */
+class ST73XXListTarget {
+public:
+    explicit ST73XXListTarget(ST73XX_UI& ui) : ui_(ui) {}
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        ui_.drawFilledRectangle(x, y, w, h, color);
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        ui_.drawRectangle(x, y, w, h, color);
+    }
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+        ui_.drawLine(x0, y0, x1, y1, color);
+    }
+
+    void drawText(int16_t x, int16_t y, const char* str, uint16_t fg, uint16_t bg) {
+        for (; *str; ++str, x += font::FONT_WIDTH) {
+            if (*str < 32 || *str > 126) continue;
+            const uint8_t* glyph = font::get_char_data(*str);
+            for (int row = 0; row < font::FONT_HEIGHT; ++row) {
+                for (int col = 0; col < font::FONT_WIDTH; ++col) {
+                    bool set = (glyph[row] >> (7 - col)) & 0x01;
+                    ui_.drawPixel(int16_t(x + col), int16_t(y + row), set ? fg : bg);
+                }
+            }
+        }
+    }
+
+    void drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels) {
+        for (int16_t j = 0; j < h; ++j) {
+            for (int16_t i = 0; i < w; ++i) {
+                ui_.drawPixel(int16_t(x + i), int16_t(y + j), pixels[j * w + i]);
+            }
+        }
+    }
+
+private:
+    ST73XX_UI& ui_;  ///< 图形层
+};
@@ -140,6 +140,7 @@ private:
     int max_lines_;                            ///< 最大行数
     int max_length_;                           ///< 每行最大字符数
     int last_updated_row_;                     ///< 最后更新的行
+    int top_row_;                              ///< 屏幕第0行显示的文本行号
     bool unsaved_changes_;                     ///< 未保存更改标志
     bool input_frozen_;                        ///< 输入冻结标志
     
@@ -153,6 +154,9 @@ private:
     void ensure_line_exists(int row);
     void update_display_line(int line_num);
     void check_and_freeze_input();
+    int visible_rows() const;
+    bool is_line_visible(int line_num) const;
+    bool ensure_cursor_visible();  ///< 视口滚动时返回true，露出的行已重绘
 };
 
 } // namespace usb2ttl 
\ No newline at end of file
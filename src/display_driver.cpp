@@ -32,6 +32,10 @@ int DisplayDriver::get_max_text_rows() const {
     return (height_ - 2 * text_offset_y_) / font_height_;
 }
 
+bool DisplayDriver::scroll_text_rows(int /* rows */) {
+    return false;
+}
+
 bool DisplayDriver::is_valid_text_position(int col, int row) const {
     return col >= 0 && col < get_max_text_cols() && 
            row >= 0 && row < get_max_text_rows();
@@ -6,16 +6,20 @@
 #include "ili9488_driver.hpp"
 #include "ili9488_colors.hpp"
 #include "ili9488_font.hpp"
+#include "ili9488_image.hpp"
 
 #include <cstdio>
 #include <cstring>
 #include <algorithm>
+#include <vector>
 
 #include "pico/stdlib.h"
 #include "hardware/gpio.h"
 #include "hardware/spi.h" 
 #include "hardware/pwm.h"
 #include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
 
 namespace ili9488 {
 
@@ -28,11 +32,16 @@ namespace Commands {
     constexpr uint8_t CASET   = 0x2A;
     constexpr uint8_t PASET   = 0x2B;
     constexpr uint8_t RAMWR   = 0x2C;
+    constexpr uint8_t RAMRD   = 0x2E;
     constexpr uint8_t MADCTL  = 0x36;
     constexpr uint8_t PIXFMT  = 0x3A;
     constexpr uint8_t PTLON   = 0x12;
     constexpr uint8_t PTLOFF  = 0x13;
     constexpr uint8_t PTLAR   = 0x30;
+    constexpr uint8_t VSCRDEF = 0x33;
+    constexpr uint8_t TEOFF   = 0x34;
+    constexpr uint8_t TEON    = 0x35;
+    constexpr uint8_t VSCRSADD = 0x37;
 }
 
 struct ILI9488Driver::Impl {
@@ -51,13 +60,85 @@ struct ILI9488Driver::Impl {
     Rotation current_rotation_ = Rotation::Portrait_0;
     FontLayout font_layout_ = FontLayout::Vertical;
     bool partial_mode_ = false;
+    ColorMode color_mode_ = ColorMode::RGB666;  // Interface pixel format (RGB666 or RGB111)
+    
+    // RGB111 packing state for the current RAMWR: two 3-bit pixels per byte
+    bool pack_has_half_ = false;  // A first pixel is waiting for its partner
+    uint8_t pack_half_ = 0;
+    uint8_t pack_first_ = 0;      // First pixel of the window, used to pad an odd count
+    bool pack_started_ = false;
     
     // DMA support
     int dma_channel_ = -1;
     volatile bool dma_busy_ = false;
+    bool release_cs_on_complete_ = true;  // false while a pixel pipeline has more batches queued
+    uint8_t fill_byte_ = 0;  // DMA source for uniform-byte fills (must outlive the transfer)
+    
+    // Current DMA job: dma_remaining_ bytes from dma_src_, dma_chunk_ bytes per
+    // transfer. Fills resend one line buffer, so each chunk restarts at dma_src_.
+    const uint8_t* dma_src_ = nullptr;
+    size_t dma_chunk_ = 0;
+    size_t dma_remaining_ = 0;
+    bool dma_read_increment_ = true;
+    
+    // Tearing-effect synchronization (te_pin_ < 0 = disabled)
+    static constexpr uint32_t TE_TIMEOUT_US = 100000;  // Give up waiting for a silent TE line
+    int te_pin_ = -1;
+    uint32_t te_min_pixels_ = 0;
+    bool te_sync_next_ = false;         // The next DMA job waits for the TE edge
+    volatile bool te_pending_ = false;  // A DMA job is parked until the TE edge
+    volatile uint32_t te_last_edge_us_ = 0;
+    volatile uint32_t te_frames_ = 0;
+    volatile uint32_t te_period_us_ = 0;
+    volatile uint32_t te_deferred_ = 0;
+    
+    // Panel readback (miso_pin_ < 0 = disabled)
+    static constexpr uint32_t READ_SPEED_HZ = 6000000;  // Serial read cycle >= 150 ns
+    int miso_pin_ = -1;
+    
+    // Address window last sent to the panel (CASET/PASET are skipped when unchanged)
+    bool window_valid_ = false;
+    uint16_t window_x0_ = 0;
+    uint16_t window_x1_ = 0;
+    uint16_t window_y0_ = 0;
+    uint16_t window_y1_ = 0;
+    
+    // Vertical scrolling area in current-rotation rows (height 0 = not scrolling)
+    uint16_t scroll_top_ = 0;
+    uint16_t scroll_height_ = 0;
+    uint16_t scroll_offset_ = 0;
     
-    // Static instance pointer for DMA callback
+    // Bus traffic counters
+    BusStats stats_;
+    
+    // Scratch line for fills and text runs (longest line in any rotation)
+    static constexpr size_t LINE_PIXELS = LCD_HEIGHT;
+    uint8_t line_buffer_[LINE_PIXELS * 3];
+    uint8_t pipeline_buffer_[LINE_PIXELS * 3];  // Second half of the ping-pong pair
+    
+    // Expanded 8x16 glyph in RGB666 wire format
+    static constexpr size_t GLYPH_ROW_BYTES = font::FONT_WIDTH * 3;
+    static constexpr size_t GLYPH_BYTES = GLYPH_ROW_BYTES * font::FONT_HEIGHT;
+    uint8_t glyph_block_[GLYPH_BYTES];
+    
+    // LRU cache of expanded glyphs (no entries = disabled). Entry i owns
+    // glyph_storage_[i * GLYPH_BYTES]; the index is scanned linearly, which
+    // is cheap next to expanding 128 pixels for a budget of a few dozen glyphs.
+    struct GlyphEntry {
+        uint32_t fg = 0;         // Foreground as packed RGB666 bytes
+        uint32_t bg = 0;         // Background as packed RGB666 bytes
+        uint32_t last_used = 0;  // glyph_clock_ at the last hit
+        char c = 0;
+        bool valid = false;
+    };
+    std::vector<GlyphEntry> glyph_entries_;
+    std::vector<uint8_t> glyph_storage_;
+    uint32_t glyph_clock_ = 0;
+    GlyphCacheStats glyph_stats_;
+    
+    // Static instance pointers for the DMA and TE callbacks
     static Impl* dma_instance_;
+    static Impl* te_instance_;
     
     // Display dimensions (considering rotation)
     uint16_t display_width_ = LCD_WIDTH;
@@ -70,6 +151,14 @@ struct ILI9488Driver::Impl {
           pin_sck_(pin_sck), pin_mosi_(pin_mosi), pin_bl_(pin_bl), spi_speed_hz_(spi_speed_hz) {
     }
     
+    ~Impl() {
+        waitForDMA();
+        disableTearingSync();
+        if (dma_instance_ == this) {
+            dma_instance_ = nullptr;
+        }
+    }
+    
     // Hardware control methods
     void setCS(bool level) {
         gpio_put(pin_cs_, level ? 1 : 0);
@@ -79,45 +168,655 @@ struct ILI9488Driver::Impl {
         gpio_put(pin_dc_, level ? 1 : 0);
     }
     
-    void writeCommand(uint8_t cmd) {
-        setCS(false);
-        setDC(false);  // Command mode
-        spi_write_blocking(spi_inst_, &cmd, 1);
-        setCS(true);
+    // Wait for any in-flight DMA transfer before touching the bus. A job
+    // parked for a TE edge that never comes is started after TE_TIMEOUT_US.
+    void waitForDMA() {
+        while (dma_busy_) {
+            if (te_pending_ && time_us_32() - te_last_edge_us_ > TE_TIMEOUT_US) {
+                uint32_t irq_state = save_and_disable_interrupts();
+                if (te_pending_) {
+                    te_pending_ = false;
+                    launchNextDMA();
+                }
+                restore_interrupts(irq_state);
+            }
+            tight_loop_contents();
+        }
     }
     
-    void writeData(uint8_t data) {
+    void beginTransfer() {
+        waitForDMA();
         setCS(false);
-        setDC(true);   // Data mode
-        spi_write_blocking(spi_inst_, &data, 1);
+        ++stats_.cs_toggles;
+    }
+    
+    void endTransfer() {
         setCS(true);
+        te_sync_next_ = false;  // A blocking write consumed the window
+    }
+    
+    void spiWrite(const uint8_t* data, size_t length) {
+        spi_write_blocking(spi_inst_, data, length);
+        stats_.bytes += length;
+    }
+    
+    void writeCommand(uint8_t cmd) {
+        writeCommandData(cmd, nullptr, 0);
     }
     
-    void writeDataBuffer(const uint8_t* data, size_t length) {
-        if (!data || length == 0) return;
+    // Send a command and its parameters in one CS assertion. DC is switched
+    // to data after the command byte; spi_write_blocking only returns once
+    // the shifter is idle, so the DC edge never clips the command.
+    void writeCommandData(uint8_t cmd, const uint8_t* data, size_t length) {
+        beginTransfer();
+        setDC(false);  // Command mode
+        spiWrite(&cmd, 1);
+        ++stats_.commands;
         
-        setCS(false);
+        if (data && length > 0) {
+            setDC(true);   // Data mode
+            spiWrite(data, length);
+        }
+        
+        endTransfer();
+    }
+    
+    // Forget the cached window (after reset or MADCTL changes)
+    void invalidateWindow() {
+        window_valid_ = false;
+    }
+    
+    // Program CASET/PASET, skipping either one when its range is unchanged
+    void setAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+        if (!window_valid_ || x0 != window_x0_ || x1 != window_x1_) {
+            const uint8_t columns[4] = {
+                uint8_t(x0 >> 8), uint8_t(x0 & 0xFF), uint8_t(x1 >> 8), uint8_t(x1 & 0xFF)
+            };
+            writeCommandData(Commands::CASET, columns, sizeof(columns));
+            window_x0_ = x0;
+            window_x1_ = x1;
+            ++stats_.window_updates;
+        } else {
+            ++stats_.window_skips;
+        }
+        
+        if (!window_valid_ || y0 != window_y0_ || y1 != window_y1_) {
+            const uint8_t pages[4] = {
+                uint8_t(y0 >> 8), uint8_t(y0 & 0xFF), uint8_t(y1 >> 8), uint8_t(y1 & 0xFF)
+            };
+            writeCommandData(Commands::PASET, pages, sizeof(pages));
+            window_y0_ = y0;
+            window_y1_ = y1;
+            ++stats_.window_updates;
+        } else {
+            ++stats_.window_skips;
+        }
+        
+        window_valid_ = true;
+    }
+    
+    // Set the window and open the RAMWR data phase. CS stays asserted with
+    // DC in data mode until endTransfer() (or the DMA completion handler).
+    void beginWrite(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+        setAddressWindow(x0, y0, x1, y1);
+        
+        // Large DMA writes start in vertical blanking once TE edges are seen
+        uint32_t area = uint32_t(x1 - x0 + 1) * (y1 - y0 + 1);
+        te_sync_next_ = te_pin_ >= 0 && te_frames_ > 0 && area >= te_min_pixels_;
+        
+        beginTransfer();
+        setDC(false);  // Command mode
+        const uint8_t cmd = Commands::RAMWR;
+        spiWrite(&cmd, 1);
+        ++stats_.commands;
         setDC(true);   // Data mode
         
-        // Write in chunks for better performance
-        size_t remaining = length;
-        const uint8_t* ptr = data;
+        pack_has_half_ = false;
+        pack_started_ = false;
+    }
+    
+    // Close a blocking RAMWR opened by beginWrite()
+    void endWrite() {
+        if (color_mode_ == ColorMode::RGB111) {
+            uint8_t pad;
+            if (finishPacking(&pad)) {
+                spiWrite(&pad, 1);
+            }
+        }
+        endTransfer();
+    }
+    
+    // Nearest of the 8 RGB111 colors: each channel rounds to 0 or full scale
+    static uint8_t toRGB111(const uint8_t* rgb666) {
+        return uint8_t(((rgb666[0] >> 7) << 2) | ((rgb666[1] >> 7) << 1) | (rgb666[2] >> 7));
+    }
+    
+    // Pack RGB666 wire pixels into RGB111 bytes (first pixel in bits 5..3,
+    // second in bits 2..0). A trailing odd pixel is carried into the next
+    // call. out may alias rgb666: each byte is written after its input is read.
+    size_t packPixels(const uint8_t* rgb666, size_t pixel_count, uint8_t* out) {
+        size_t written = 0;
+        for (size_t i = 0; i < pixel_count; ++i) {
+            uint8_t code = toRGB111(rgb666 + i * 3);
+            if (!pack_started_) {
+                pack_first_ = code;
+                pack_started_ = true;
+            }
+            if (pack_has_half_) {
+                out[written++] = uint8_t((pack_half_ << 3) | code);
+                pack_has_half_ = false;
+            } else {
+                pack_half_ = code;
+                pack_has_half_ = true;
+            }
+        }
+        return written;
+    }
+    
+    // Complete an odd pixel count. The extra pixel wraps to the start of the
+    // window, so it repeats the first pixel and leaves the panel unchanged.
+    size_t finishPacking(uint8_t* out) {
+        if (!pack_has_half_) return 0;
+        out[0] = uint8_t((pack_half_ << 3) | pack_first_);
+        pack_has_half_ = false;
+        return 1;
+    }
+    
+    // Send RGB666 pixels in the current interface format. In RGB111 mode the
+    // buffer is packed in place, so it must be scratch memory.
+    void writePixelData(uint8_t* rgb666, size_t pixel_count) {
+        if (color_mode_ == ColorMode::RGB111) {
+            spiWrite(rgb666, packPixels(rgb666, pixel_count, rgb666));
+        } else {
+            spiWrite(rgb666, pixel_count * 3);
+        }
+    }
+    
+    // Start a DMA job of length bytes from src into the SPI TX FIFO, sent as
+    // transfers of at most chunk bytes that each restart at src (0 = one
+    // transfer). With release_cs the completion handler closes the
+    // transaction; otherwise CS stays asserted for the next job. If the
+    // window asked for TE sync the job is parked until the next TE edge.
+    void startDMA(const uint8_t* src, size_t length, bool read_increment, bool release_cs,
+                  size_t chunk = 0) {
+        stats_.bytes += length;
+        release_cs_on_complete_ = release_cs;
+        dma_src_ = src;
+        dma_chunk_ = chunk ? chunk : length;
+        dma_remaining_ = length;
+        dma_read_increment_ = read_increment;
+        dma_busy_ = true;
+        
+        if (te_sync_next_) {
+            te_sync_next_ = false;
+            ++te_deferred_;
+            te_pending_ = true;  // Started by teEdgeHandler()
+            return;
+        }
+        launchNextDMA();
+    }
+    
+    // Queue the next chunk of the current DMA job
+    void launchNextDMA() {
+        size_t length = std::min(dma_remaining_, dma_chunk_);
+        dma_remaining_ -= length;
+        
+        dma_channel_config config = dma_channel_get_default_config(dma_channel_);
+        channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
+        channel_config_set_dreq(&config, spi_get_dreq(spi_inst_, true));
+        channel_config_set_read_increment(&config, dma_read_increment_);
+        channel_config_set_write_increment(&config, false);
+        
+        dma_channel_configure(
+            dma_channel_,
+            &config,
+            &spi_get_hw(spi_inst_)->dr,
+            dma_src_,
+            length,
+            true
+        );
+    }
+    
+    // Stream pixel_count copies of one RGB666 pixel into the window opened by
+    // beginWrite() and close it. Uniform-byte colors (black, white, grays) go
+    // out via DMA from a single non-incrementing source byte; other colors
+    // are replicated into line_buffer_, which DMA resends once per line.
+    // Either way the call returns before the transfer completes.
+    void streamFill(const uint8_t* pixel, uint32_t pixel_count) {
+        size_t total_bytes = size_t(pixel_count) * 3;
+        uint8_t uniform_byte = pixel[0];
+        bool uniform = pixel[0] == pixel[1] && pixel[1] == pixel[2];
+        
+        // In RGB111 every fill is one repeated byte; an odd count is padded
+        // with the same color
+        if (color_mode_ == ColorMode::RGB111) {
+            uint8_t code = toRGB111(pixel);
+            uniform_byte = uint8_t((code << 3) | code);
+            uniform = true;
+            total_bytes = (size_t(pixel_count) + 1) / 2;
+        }
+        
+        if (dma_channel_ >= 0 && pixel_count > 0 && uniform) {
+            fill_byte_ = uniform_byte;
+            startDMA(&fill_byte_, total_bytes, false, true);
+            return;  // CS is released by the DMA completion handler
+        }
+        
+        size_t line_bytes;
+        if (color_mode_ == ColorMode::RGB111) {
+            line_bytes = std::min(total_bytes, sizeof(line_buffer_));
+            memset(line_buffer_, uniform_byte, line_bytes);
+        } else {
+            size_t line_pixels = std::min<size_t>(pixel_count, LINE_PIXELS);
+            for (size_t i = 0; i < line_pixels; ++i) {
+                line_buffer_[i * 3]     = pixel[0];
+                line_buffer_[i * 3 + 1] = pixel[1];
+                line_buffer_[i * 3 + 2] = pixel[2];
+            }
+            line_bytes = line_pixels * 3;
+        }
         
+        if (dma_channel_ >= 0 && pixel_count > 0) {
+            startDMA(line_buffer_, total_bytes, true, true, line_bytes);
+            return;  // CS is released by the DMA completion handler
+        }
+        
+        size_t remaining = total_bytes;
         while (remaining > 0) {
-            size_t chunk_size = std::min(remaining, size_t(4096));
-            spi_write_blocking(spi_inst_, ptr, chunk_size);
-            ptr += chunk_size;
+            size_t chunk_size = std::min(remaining, line_bytes);
+            spiWrite(line_buffer_, chunk_size);
             remaining -= chunk_size;
         }
         
-        setCS(true);
+        endTransfer();
+    }
+    
+    // Source of streamPixels(): rows of width pixels, stride pixels apart
+    // (stride == width for a contiguous array). Batches may split rows.
+    template <typename Pixel>
+    struct PixelSource {
+        const Pixel* row;
+        size_t width;
+        size_t stride;
+        size_t column = 0;
+        void (*convert)(const Pixel*, uint8_t*, size_t);
+        
+        void read(uint8_t* out, size_t count) {
+            while (count > 0) {
+                size_t take = std::min(count, width - column);
+                convert(row + column, out, take);
+                out += take * 3;
+                count -= take;
+                column += take;
+                if (column == width) {
+                    column = 0;
+                    row += stride;
+                }
+            }
+        }
+    };
+    
+    // Source of streamPixels() for 4bpp palette indices, two pixels per
+    // byte with the even pixel in the high nibble
+    struct Palette4Source {
+        const uint8_t* row;
+        size_t stride;
+        size_t first_nibble;
+        size_t width;
+        size_t column = 0;
+        uint8_t palette[16][3] = {};
+        
+        void read(uint8_t* out, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                size_t nibble = first_nibble + column;
+                uint8_t cell = row[nibble >> 1];
+                const uint8_t* src = palette[(nibble & 1) ? (cell & 0x0F) : (cell >> 4)];
+                out[0] = src[0];
+                out[1] = src[1];
+                out[2] = src[2];
+                out += 3;
+                if (++column == width) {
+                    column = 0;
+                    row += stride;
+                }
+            }
+        }
+    };
+    
+    // Convert pixels to RGB666 one line at a time and stream them into the
+    // window opened by beginWrite(), then close it. With DMA the two line
+    // buffers ping-pong: the next line is converted while the previous one
+    // drains, and the last transfer completes asynchronously. Pixels are
+    // always copied out of the caller's array before it is sent, so the
+    // caller may reuse it as soon as this returns.
+    template <typename Pixel>
+    void streamPixels(const Pixel* pixels, size_t count,
+                      void (*convert)(const Pixel*, uint8_t*, size_t)) {
+        streamPixels(PixelSource<Pixel>{pixels, count, count, 0, convert}, count);
+    }
+    
+    // Source provides read(uint8_t* rgb666, size_t pixels), called in order
+    template <typename Source>
+    void streamPixels(Source source, size_t count) {
+        if (dma_channel_ >= 0) {
+            uint8_t* buffers[2] = {line_buffer_, pipeline_buffer_};
+            int current = 0;
+            while (count > 0) {
+                size_t batch = std::min(count, LINE_PIXELS);
+                uint8_t* buffer = buffers[current];
+                source.read(buffer, batch);
+                count -= batch;
+                
+                size_t bytes = batch * 3;
+                if (color_mode_ == ColorMode::RGB111) {
+                    bytes = packPixels(buffer, batch, buffer);
+                    if (count == 0) {
+                        bytes += finishPacking(buffer + bytes);
+                    }
+                }
+                
+                waitForDMA();  // The other buffer has been handed to the FIFO
+                startDMA(buffer, bytes, true, count == 0);
+                current ^= 1;
+            }
+            return;  // CS is released by the DMA completion handler
+        }
+        
+        while (count > 0) {
+            size_t batch = std::min(count, LINE_PIXELS);
+            source.read(line_buffer_, batch);
+            writePixelData(line_buffer_, batch);
+            count -= batch;
+        }
+        
+        endWrite();
+    }
+    
+    // Source of streamPixels() for a linear gradient: each channel is a
+    // 16.16 fixed-point value stepped by column_step along a row and by
+    // row_step from one row start to the next. No division per pixel.
+    // Values outside 0..255 (the far corner of a plane) are clamped.
+    struct GradientSource {
+        size_t width;
+        size_t column = 0;
+        int32_t row_start[3] = {};
+        int32_t value[3] = {};
+        int32_t column_step[3] = {};
+        int32_t row_step[3] = {};
+        
+        void read(uint8_t* out, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                for (int c = 0; c < 3; ++c) {
+                    int32_t v = std::min(std::max(value[c], int32_t(0)), int32_t(0xFFFFFF));
+                    *out++ = uint8_t(v >> 16) & 0xFC;
+                    value[c] += column_step[c];
+                }
+                if (++column == width) {
+                    column = 0;
+                    for (int c = 0; c < 3; ++c) {
+                        row_start[c] += row_step[c];
+                        value[c] = row_start[c];
+                    }
+                }
+            }
+        }
+    };
+    
+    // Fill the window opened by beginWrite() with a gradient. When every row
+    // is the same, one line is built and DMA resends it for each row.
+    void streamGradient(GradientSource source, size_t rows) {
+        bool same_rows = source.row_step[0] == 0 && source.row_step[1] == 0 && source.row_step[2] == 0;
+        if (dma_channel_ >= 0 && same_rows && color_mode_ == ColorMode::RGB666) {
+            size_t line_bytes = source.width * 3;
+            source.read(line_buffer_, source.width);
+            startDMA(line_buffer_, line_bytes * rows, true, true, line_bytes);
+            return;  // CS is released by the DMA completion handler
+        }
+        streamPixels(source, source.width * rows);
+    }
+    
+    // Source of streamPixels() that decodes a packed image; the decoder
+    // is referenced so its error state survives the stream
+    struct ImageSource {
+        ImageDecoder& decoder;
+        
+        void read(uint8_t* out, size_t count) {
+            decoder.read(out, count);
+        }
+    };
+    
+    // Source of streamPixels() for two 1bpp masks: mask bits take color[0],
+    // edge bits color[1] and everything else color[2] (RGB666 bytes)
+    struct MaskSource {
+        const uint32_t* mask;
+        const uint32_t* edge;
+        size_t stride;
+        size_t first_bit;
+        size_t width;
+        size_t column = 0;
+        uint8_t color[3][3] = {};
+        
+        void read(uint8_t* out, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                size_t bit = first_bit + column;
+                uint32_t select = 0x80000000u >> (bit & 31);
+                const uint8_t* src = (mask[bit >> 5] & select) ? color[0]
+                                   : (edge && (edge[bit >> 5] & select)) ? color[1]
+                                   : color[2];
+                out[0] = src[0];
+                out[1] = src[1];
+                out[2] = src[2];
+                out += 3;
+                if (++column == width) {
+                    column = 0;
+                    mask += stride;
+                    if (edge) edge += stride;
+                }
+            }
+        }
+    };
+    
+    // Expand one glyph row (MSB = leftmost pixel) into RGB666 bytes
+    static uint8_t* expandGlyphRow(uint8_t bits, uint8_t columns,
+                                   const uint8_t* fg, const uint8_t* bg, uint8_t* out) {
+        for (uint8_t col = 0; col < columns; ++col) {
+            const uint8_t* src = (bits & (0x80 >> col)) ? fg : bg;
+            out[0] = src[0];
+            out[1] = src[1];
+            out[2] = src[2];
+            out += 3;
+        }
+        return out;
+    }
+    
+    static uint32_t packColor(const uint8_t* rgb666) {
+        return (uint32_t(rgb666[0]) << 16) | (uint32_t(rgb666[1]) << 8) | rgb666[2];
+    }
+    
+    // Cached glyph for (c, fg, bg), or nullptr; never expands or evicts.
+    // Used for cells cut by the display edge, which are not worth caching.
+    const uint8_t* findGlyph(char c, const uint8_t* fg, const uint8_t* bg) {
+        uint32_t fg_key = packColor(fg);
+        uint32_t bg_key = packColor(bg);
+        for (GlyphEntry& entry : glyph_entries_) {
+            if (entry.valid && entry.c == c && entry.fg == fg_key && entry.bg == bg_key) {
+                entry.last_used = ++glyph_clock_;
+                ++glyph_stats_.hits;
+                return &glyph_storage_[(&entry - glyph_entries_.data()) * GLYPH_BYTES];
+            }
+        }
+        return nullptr;
+    }
+    
+    // Find or expand the cached glyph for (c, fg, bg). On a miss the least
+    // recently used entry is replaced, skipping entries used at or after
+    // pinned_since so a run can hold pointers to all of its glyphs. Returns
+    // nullptr when the cache is disabled or every entry is pinned.
+    const uint8_t* lookupGlyph(char c, const uint8_t* fg, const uint8_t* bg,
+                               uint32_t pinned_since = UINT32_MAX) {
+        if (glyph_entries_.empty()) return nullptr;
+        
+        uint32_t fg_key = packColor(fg);
+        uint32_t bg_key = packColor(bg);
+        GlyphEntry* victim = nullptr;
+        for (GlyphEntry& entry : glyph_entries_) {
+            if (entry.valid && entry.c == c && entry.fg == fg_key && entry.bg == bg_key) {
+                entry.last_used = ++glyph_clock_;
+                ++glyph_stats_.hits;
+                return &glyph_storage_[(&entry - glyph_entries_.data()) * GLYPH_BYTES];
+            }
+            if (entry.valid && entry.last_used >= pinned_since) continue;
+            if (!victim || (victim->valid && (!entry.valid || entry.last_used < victim->last_used))) {
+                victim = &entry;
+            }
+        }
+        
+        ++glyph_stats_.misses;
+        if (!victim) return nullptr;
+        if (victim->valid) {
+            ++glyph_stats_.evictions;
+        } else {
+            ++glyph_stats_.entries;
+        }
+        
+        // The replaced block may still be feeding a DMA transfer
+        uint8_t* block = &glyph_storage_[(victim - glyph_entries_.data()) * GLYPH_BYTES];
+        if (dma_busy_ && dma_src_ == block) {
+            waitForDMA();
+        }
+        
+        const uint8_t* char_data = font::get_char_data(c);
+        uint8_t* out = block;
+        for (int row = 0; row < font::FONT_HEIGHT; ++row) {
+            out = expandGlyphRow(char_data[row], font::FONT_WIDTH, fg, bg, out);
+        }
+        
+        victim->c = c;
+        victim->fg = fg_key;
+        victim->bg = bg_key;
+        victim->last_used = ++glyph_clock_;
+        victim->valid = true;
+        return block;
+    }
+    
+    void enableGlyphCache(size_t budget_bytes) {
+        waitForDMA();  // A transfer may be reading the old storage
+        size_t capacity = budget_bytes / (GLYPH_BYTES + sizeof(GlyphEntry));
+        glyph_entries_.assign(capacity, GlyphEntry{});
+        glyph_storage_.assign(capacity * GLYPH_BYTES, 0);
+        glyph_entries_.shrink_to_fit();
+        glyph_storage_.shrink_to_fit();
+        glyph_clock_ = 0;
+        glyph_stats_ = GlyphCacheStats{};
+        glyph_stats_.capacity = uint32_t(capacity);
+        glyph_stats_.bytes = uint32_t(capacity * (GLYPH_BYTES + sizeof(GlyphEntry)));
+    }
+    
+    void disableGlyphCache() {
+        waitForDMA();
+        std::vector<GlyphEntry>().swap(glyph_entries_);
+        std::vector<uint8_t>().swap(glyph_storage_);
+        glyph_stats_ = GlyphCacheStats{};
+    }
+    
+    // Draw a run of printable characters through a single window.
+    // Each glyph row of the run is built in line_buffer_ and sent while CS
+    // stays asserted for the whole run. Cached glyphs are copied row by row;
+    // the rest are expanded from the font bitmap.
+    void drawTextRun(uint16_t x, uint16_t y, const char* chars, size_t count,
+                     const uint8_t* fg, const uint8_t* bg) {
+        using namespace font;
+        
+        if (count == 0 || x >= display_width_ || y >= display_height_) return;
+        
+        uint16_t run_width = static_cast<uint16_t>(
+            std::min<uint32_t>(uint32_t(count) * FONT_WIDTH, display_width_ - x));
+        uint16_t rows = static_cast<uint16_t>(std::min<int>(FONT_HEIGHT, display_height_ - y));
+        size_t visible = (run_width + FONT_WIDTH - 1) / FONT_WIDTH;
+        
+        // Resolve the run's glyphs once; entries used by this run are pinned.
+        // Cells cut by the display edge only reuse glyphs already cached.
+        const uint8_t* cached[LINE_PIXELS / FONT_WIDTH] = {};
+        if (!glyph_entries_.empty()) {
+            uint32_t run_start = glyph_clock_ + 1;
+            for (size_t i = 0; i < visible; ++i) {
+                bool whole = rows == FONT_HEIGHT && (i + 1) * FONT_WIDTH <= run_width;
+                cached[i] = whole ? lookupGlyph(chars[i], fg, bg, run_start)
+                                  : findGlyph(chars[i], fg, bg);
+            }
+        }
+        
+        beginWrite(x, y, x + run_width - 1, y + rows - 1);
+        
+        for (uint16_t row = 0; row < rows; ++row) {
+            uint8_t* out = line_buffer_;
+            uint16_t remaining = run_width;
+            for (size_t i = 0; i < visible; ++i) {
+                uint8_t columns = static_cast<uint8_t>(std::min<uint16_t>(FONT_WIDTH, remaining));
+                if (cached[i]) {
+                    memcpy(out, cached[i] + row * GLYPH_ROW_BYTES, columns * 3);
+                    out += columns * 3;
+                } else {
+                    out = expandGlyphRow(get_char_data(chars[i])[row], columns, fg, bg, out);
+                }
+                remaining -= columns;
+            }
+            writePixelData(line_buffer_, run_width);
+        }
+        
+        endWrite();
+    }
+    
+    // Program VSCRDEF. The panel counts its fixed areas in scan order; with
+    // MY set (Portrait_180) scan order is the reverse of our row order, so
+    // the panel's top fixed area is our bottom one.
+    void writeScrollDefinition(uint16_t top_fixed, uint16_t height, uint16_t bottom_fixed) {
+        if (current_rotation_ == Rotation::Portrait_180) {
+            std::swap(top_fixed, bottom_fixed);
+        }
+        const uint8_t params[6] = {
+            uint8_t(top_fixed >> 8), uint8_t(top_fixed & 0xFF),
+            uint8_t(height >> 8), uint8_t(height & 0xFF),
+            uint8_t(bottom_fixed >> 8), uint8_t(bottom_fixed & 0xFF)
+        };
+        writeCommandData(Commands::VSCRDEF, params, sizeof(params));
+    }
+    
+    // Program VSCRSADD so that screen row top + i shows memory row
+    // top + (i + offset) % height. In reversed scan order this means
+    // starting the scan offset rows before the end of the area instead.
+    // Without an area the scan starts at the first row.
+    void writeScrollStart(uint16_t offset) {
+        uint16_t start;
+        if (scroll_height_ == 0) {
+            start = 0;
+        } else if (current_rotation_ == Rotation::Portrait_180) {
+            uint16_t panel_top = LCD_HEIGHT - scroll_top_ - scroll_height_;
+            start = panel_top + (scroll_height_ - offset) % scroll_height_;
+        } else {
+            start = scroll_top_ + offset;
+        }
+        const uint8_t params[2] = {uint8_t(start >> 8), uint8_t(start & 0xFF)};
+        writeCommandData(Commands::VSCRSADD, params, sizeof(params));
     }
     
     // DMA completion callback
     void dmaCompleteHandler() {
-        setCS(true);
-        dma_busy_ = false;
         dma_channel_acknowledge_irq0(dma_channel_);
+        if (dma_remaining_ > 0) {
+            launchNextDMA();
+            return;
+        }
+        
+        // DMA finishes when the last byte enters the TX FIFO, not when it
+        // leaves the shifter; keep CS asserted until the SPI goes idle
+        if (release_cs_on_complete_) {
+            while (spi_is_busy(spi_inst_)) {
+                tight_loop_contents();
+            }
+            setCS(true);
+        }
+        dma_busy_ = false;
     }
     
     // Static callback wrapper
@@ -127,6 +826,106 @@ struct ILI9488Driver::Impl {
         }
     }
     
+    // TE rising edge: vertical blanking has started
+    void teEdgeHandler() {
+        uint32_t now = time_us_32();
+        if (te_frames_ > 0) {
+            te_period_us_ = now - te_last_edge_us_;
+        }
+        te_last_edge_us_ = now;
+        te_frames_ = te_frames_ + 1;
+        
+        if (te_pending_) {
+            te_pending_ = false;
+            launchNextDMA();
+        }
+    }
+    
+    // Raw GPIO handlers are shared by all pins of the bank; only take ours
+    static void teCallback() {
+        if (!te_instance_ || te_instance_->te_pin_ < 0) return;
+        uint pin = static_cast<uint>(te_instance_->te_pin_);
+        if (gpio_get_irq_event_mask(pin) & GPIO_IRQ_EDGE_RISE) {
+            gpio_acknowledge_irq(pin, GPIO_IRQ_EDGE_RISE);
+            te_instance_->teEdgeHandler();
+        }
+    }
+    
+    // Turn on the TE output (V-blank only) and start catching its edges
+    bool enableTearingSync(uint8_t pin_te, uint32_t min_pixels) {
+        if (dma_channel_ < 0) {
+            return false;  // Deferred starts need a DMA channel
+        }
+        disableTearingSync();
+        
+        const uint8_t mode = 0x00;  // TELOM = 0: V-blanking information only
+        writeCommandData(Commands::TEON, &mode, 1);
+        
+        gpio_init(pin_te);
+        gpio_set_dir(pin_te, GPIO_IN);
+        
+        te_frames_ = 0;
+        te_period_us_ = 0;
+        te_deferred_ = 0;
+        te_min_pixels_ = min_pixels;
+        te_pin_ = pin_te;
+        te_instance_ = this;
+        
+        gpio_add_raw_irq_handler(pin_te, teCallback);
+        gpio_set_irq_enabled(pin_te, GPIO_IRQ_EDGE_RISE, true);
+        irq_set_enabled(IO_IRQ_BANK0, true);
+        return true;
+    }
+    
+    void disableTearingSync() {
+        if (te_pin_ < 0) return;
+        
+        waitForDMA();
+        uint pin = static_cast<uint>(te_pin_);
+        gpio_set_irq_enabled(pin, GPIO_IRQ_EDGE_RISE, false);
+        gpio_remove_raw_irq_handler(pin, teCallback);
+        te_pin_ = -1;
+        te_sync_next_ = false;
+        if (te_instance_ == this) {
+            te_instance_ = nullptr;
+        }
+        writeCommand(Commands::TEOFF);
+    }
+    
+    // Read a window with RAMRD. After the command the panel clocks out one
+    // dummy byte, then three bytes (R, G, B, 6 bits left-aligned) per pixel.
+    void readPixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t* colors) {
+        size_t count = size_t(x1 - x0 + 1) * (y1 - y0 + 1);
+        
+        setAddressWindow(x0, y0, x1, y1);
+        beginTransfer();
+        setDC(false);
+        const uint8_t cmd = Commands::RAMRD;
+        spiWrite(&cmd, 1);
+        ++stats_.commands;
+        setDC(true);
+        
+        uint32_t write_speed = spi_get_baudrate(spi_inst_);
+        spi_set_baudrate(spi_inst_, READ_SPEED_HZ);
+        
+        uint8_t dummy;
+        spi_read_blocking(spi_inst_, 0x00, &dummy, 1);
+        while (count > 0) {
+            size_t batch = std::min(count, LINE_PIXELS);
+            spi_read_blocking(spi_inst_, 0x00, line_buffer_, batch * 3);
+            for (size_t i = 0; i < batch; ++i) {
+                const uint8_t* px = line_buffer_ + i * 3;
+                *colors++ = uint16_t(((px[0] & 0xF8) << 8) | ((px[1] & 0xFC) << 3) | (px[2] >> 3));
+            }
+            stats_.bytes += batch * 3;
+            count -= batch;
+        }
+        stats_.bytes += 1;
+        
+        spi_set_baudrate(spi_inst_, write_speed);
+        endTransfer();
+    }
+    
     // Convert RGB565 to RGB666 bytes
     void rgb565ToRGB666Bytes(uint16_t color, uint8_t* bytes) {
         // 提取RGB565的各个分量
@@ -158,26 +957,6 @@ struct ILI9488Driver::Impl {
         bytes[2] = b8 & 0xFC;  // 保留高6位，清除低2位
     }
     
-    // Set drawing window
-    void setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
-        // Column address
-        writeCommand(Commands::CASET);
-        writeData(x0 >> 8);
-        writeData(x0 & 0xFF);
-        writeData(x1 >> 8);
-        writeData(x1 & 0xFF);
-        
-        // Row address
-        writeCommand(Commands::PASET);
-        writeData(y0 >> 8);
-        writeData(y0 & 0xFF);
-        writeData(y1 >> 8);
-        writeData(y1 & 0xFF);
-        
-        // Write to RAM
-        writeCommand(Commands::RAMWR);
-    }
-    
     // Initialize hardware
     bool initializeHardware() {
         // Initialize SPI
@@ -231,6 +1010,7 @@ struct ILI9488Driver::Impl {
     void initializationSequence() {
         // Software reset
         writeCommand(Commands::SWRESET);
+        invalidateWindow();
         sleep_ms(200);
         
         // Exit sleep mode
@@ -238,42 +1018,34 @@ struct ILI9488Driver::Impl {
         sleep_ms(200);
         
         // Memory access control
-        writeCommand(Commands::MADCTL);
-        writeData(0x48);
+        const uint8_t madctl = 0x48;
+        writeCommandData(Commands::MADCTL, &madctl, 1);
         
-        // Pixel format (18-bit RGB666)
-        writeCommand(Commands::PIXFMT);
-        writeData(0x66);
+        // Pixel format (18-bit RGB666, or 3-bit if selected before initialize())
+        const uint8_t pixfmt = (color_mode_ == ColorMode::RGB111) ? 0x61 : 0x66;
+        writeCommandData(Commands::PIXFMT, &pixfmt, 1);
         
         // VCOM control
-        writeCommand(0xC5);
-        writeData(0x00);
-        writeData(0x36);
-        writeData(0x80);
+        const uint8_t vcom[] = {0x00, 0x36, 0x80};
+        writeCommandData(0xC5, vcom, sizeof(vcom));
         
         // Power control
-        writeCommand(0xC2);
-        writeData(0xA7);
+        const uint8_t power = 0xA7;
+        writeCommandData(0xC2, &power, 1);
         
         // Positive gamma correction
-        writeCommand(0xE0);
         const uint8_t gamma_pos[] = {
             0xF0, 0x01, 0x06, 0x0F, 0x12, 0x1D, 0x36, 0x54,
             0x44, 0x0C, 0x18, 0x16, 0x13, 0x15
         };
-        for (uint8_t data : gamma_pos) {
-            writeData(data);
-        }
+        writeCommandData(0xE0, gamma_pos, sizeof(gamma_pos));
         
         // Negative gamma correction
-        writeCommand(0xE1);
         const uint8_t gamma_neg[] = {
             0xF0, 0x01, 0x05, 0x0A, 0x0B, 0x07, 0x32, 0x44,
             0x44, 0x0C, 0x18, 0x17, 0x13, 0x16
         };
-        for (uint8_t data : gamma_neg) {
-            writeData(data);
-        }
+        writeCommandData(0xE1, gamma_neg, sizeof(gamma_neg));
         
         // Invert display
         writeCommand(Commands::INVON);
@@ -313,6 +1085,7 @@ struct ILI9488Driver::Impl {
 
 // Static member definition
 ILI9488Driver::Impl* ILI9488Driver::Impl::dma_instance_ = nullptr;
+ILI9488Driver::Impl* ILI9488Driver::Impl::te_instance_ = nullptr;
 
 // Constructor
 ILI9488Driver::ILI9488Driver(spi_inst_t* spi_inst, uint8_t pin_dc, uint8_t pin_rst, uint8_t pin_cs,
@@ -351,6 +1124,9 @@ bool ILI9488Driver::initialize() {
 // Reset the display hardware
 void ILI9488Driver::reset() {
     pImpl_->hardwareReset();
+    pImpl_->invalidateWindow();
+    pImpl_->scroll_height_ = 0;
+    pImpl_->scroll_offset_ = 0;
 }
 
 // Clear the display buffer
@@ -369,11 +1145,12 @@ void ILI9488Driver::drawPixel(uint16_t x, uint16_t y, uint16_t color565) {
         return;
     }
     
-    pImpl_->setWindow(x, y, x, y);
-    
     uint8_t rgb666_bytes[3];
     pImpl_->rgb565ToRGB666Bytes(color565, rgb666_bytes);
-    pImpl_->writeDataBuffer(rgb666_bytes, 3);
+    
+    pImpl_->beginWrite(x, y, x, y);
+    pImpl_->writePixelData(rgb666_bytes, 1);
+    pImpl_->endWrite();
 }
 
 // Draw a single pixel (RGB888/24-bit)
@@ -382,11 +1159,12 @@ void ILI9488Driver::drawPixelRGB24(uint16_t x, uint16_t y, uint32_t color24) {
         return;
     }
     
-    pImpl_->setWindow(x, y, x, y);
-    
     uint8_t rgb666_bytes[3];
     pImpl_->rgb888ToRGB666Bytes(color24, rgb666_bytes);
-    pImpl_->writeDataBuffer(rgb666_bytes, 3);
+    
+    pImpl_->beginWrite(x, y, x, y);
+    pImpl_->writePixelData(rgb666_bytes, 1);
+    pImpl_->endWrite();
 }
 
 // Draw a single pixel (RGB666/18-bit native)
@@ -399,62 +1177,153 @@ void ILI9488Driver::writePixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t
                                 const uint16_t* colors, size_t count) {
     if (!colors || count == 0) return;
     
-    pImpl_->setWindow(x0, y0, x1, y1);
+    pImpl_->beginWrite(x0, y0, x1, y1);
+    pImpl_->streamPixels(colors, count, ili9488_colors::rgb565_to_rgb666_bytes);
+}
+
+// Write multiple pixels (RGB888)
+void ILI9488Driver::writePixelsRGB24(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                                     const uint32_t* colors, size_t count) {
+    if (!colors || count == 0) return;
     
-    // Convert and send in batches
-    constexpr size_t BATCH_SIZE = 256;
-    uint8_t batch_buffer[BATCH_SIZE * 3];
+    pImpl_->beginWrite(x0, y0, x1, y1);
+    pImpl_->streamPixels(colors, count, ili9488_colors::rgb888_to_rgb666_bytes);
+}
+
+// Write a window of 4bpp palette indices
+void ILI9488Driver::writePalette4Pixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                                        const uint8_t* indices, size_t stride, size_t first_nibble,
+                                        const uint32_t* palette, size_t palette_size) {
+    if (!indices || !palette || x0 > x1 || y0 > y1) return;
     
-    size_t remaining = count;
-    const uint16_t* color_ptr = colors;
+    size_t width = size_t(x1 - x0) + 1;
+    Impl::Palette4Source source{indices, stride, first_nibble & 1, width};
+    ili9488_colors::rgb888_to_rgb666_bytes(palette, source.palette[0], std::min<size_t>(palette_size, 16));
     
-    while (remaining > 0) {
-        size_t batch_count = std::min(remaining, BATCH_SIZE);
-        
-        for (size_t i = 0; i < batch_count; ++i) {
-            pImpl_->rgb565ToRGB666Bytes(color_ptr[i], &batch_buffer[i * 3]);
-        }
-        
-        pImpl_->writeDataBuffer(batch_buffer, batch_count * 3);
+    pImpl_->beginWrite(x0, y0, x1, y1);
+    pImpl_->streamPixels(source, width * (y1 - y0 + 1));
+}
+
+// Write a window from a larger RGB565 image
+void ILI9488Driver::writePixelsStrided(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                                       const uint16_t* colors, size_t stride) {
+    if (!colors || x0 > x1 || y0 > y1) return;
+    
+    size_t width = size_t(x1 - x0) + 1;
+    pImpl_->beginWrite(x0, y0, x1, y1);
+    pImpl_->streamPixels(Impl::PixelSource<uint16_t>{
+        colors, width, std::max(stride, width), 0, ili9488_colors::rgb565_to_rgb666_bytes},
+        width * (y1 - y0 + 1));
+}
+
+// Write a window from a larger RGB888 image
+void ILI9488Driver::writePixelsRGB24Strided(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                                            const uint32_t* colors, size_t stride) {
+    if (!colors || x0 > x1 || y0 > y1) return;
+    
+    size_t width = size_t(x1 - x0) + 1;
+    pImpl_->beginWrite(x0, y0, x1, y1);
+    pImpl_->streamPixels(Impl::PixelSource<uint32_t>{
+        colors, width, std::max(stride, width), 0, ili9488_colors::rgb888_to_rgb666_bytes},
+        width * (y1 - y0 + 1));
+}
+
+// Write a window colored from two 1bpp masks
+void ILI9488Driver::writeMaskPixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                                    const uint32_t* mask, const uint32_t* edge_mask,
+                                    size_t stride_words, size_t first_bit,
+                                    uint16_t color, uint16_t edge_color, uint16_t bg_color) {
+    if (!mask || x0 > x1 || y0 > y1) return;
+    
+    size_t width = size_t(x1 - x0) + 1;
+    Impl::MaskSource source{mask, edge_mask, stride_words, first_bit, width};
+    pImpl_->rgb565ToRGB666Bytes(color, source.color[0]);
+    pImpl_->rgb565ToRGB666Bytes(edge_color, source.color[1]);
+    pImpl_->rgb565ToRGB666Bytes(bg_color, source.color[2]);
+    
+    pImpl_->beginWrite(x0, y0, x1, y1);
+    pImpl_->streamPixels(source, width * (y1 - y0 + 1));
+}
+
+// Draw a packed image through the pixel pipeline
+bool ILI9488Driver::drawImage(uint16_t x, uint16_t y, const uint8_t* data, size_t size) {
+    ImageDecoder decoder;
+    if (!decoder.begin(data, size) || decoder.width() == 0 || decoder.height() == 0) {
+        return false;
+    }
+    uint32_t x1 = uint32_t(x) + decoder.width() - 1;
+    uint32_t y1 = uint32_t(y) + decoder.height() - 1;
+    if (x1 >= pImpl_->display_width_ || y1 >= pImpl_->display_height_) {
+        return false;
+    }
+    
+    pImpl_->beginWrite(x, y, x1, y1);
+    pImpl_->streamPixels(Impl::ImageSource{decoder}, decoder.remaining());
+    return !decoder.error();
+}
+
+// Fill a window with a linear gradient through three corner colors
+void ILI9488Driver::fillGradientRGB24(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                                      uint32_t color, uint32_t color_right, uint32_t color_bottom) {
+    if (x0 > x1 || y0 > y1) return;
+    
+    size_t width = size_t(x1 - x0) + 1;
+    size_t rows = size_t(y1 - y0) + 1;
+    Impl::GradientSource source{width};
+    for (int c = 0; c < 3; ++c) {
+        int shift = 16 - 8 * c;
+        int32_t start = int32_t((color >> shift) & 0xFF);
+        int32_t right = int32_t((color_right >> shift) & 0xFF);
+        int32_t bottom = int32_t((color_bottom >> shift) & 0xFF);
         
-        color_ptr += batch_count;
-        remaining -= batch_count;
+        // Half-unit bias so truncation rounds to nearest
+        source.row_start[c] = start * 65536 + 0x8000;
+        source.value[c] = source.row_start[c];
+        source.column_step[c] = width > 1 ? (right - start) * 65536 / int32_t(width - 1) : 0;
+        source.row_step[c] = rows > 1 ? (bottom - start) * 65536 / int32_t(rows - 1) : 0;
     }
+    
+    pImpl_->beginWrite(x0, y0, x1, y1);
+    pImpl_->streamGradient(source, rows);
 }
 
 // Fill rectangular area (RGB565)
 void ILI9488Driver::fillArea(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
     if (x0 > x1 || y0 > y1) return;
     
-    pImpl_->setWindow(x0, y0, x1, y1);
-    
     uint8_t rgb666_bytes[3];
     pImpl_->rgb565ToRGB666Bytes(color, rgb666_bytes);
     
-    uint32_t pixel_count = (x1 - x0 + 1) * (y1 - y0 + 1);
+    uint32_t pixel_count = uint32_t(x1 - x0 + 1) * (y1 - y0 + 1);
+    pImpl_->beginWrite(x0, y0, x1, y1);
+    pImpl_->streamFill(rgb666_bytes, pixel_count);
+}
+
+// Fill rectangular area (RGB888)
+void ILI9488Driver::fillAreaRGB24(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint32_t color) {
+    if (x0 > x1 || y0 > y1) return;
+    
+    uint8_t rgb666_bytes[3];
+    pImpl_->rgb888ToRGB666Bytes(color, rgb666_bytes);
     
-    for (uint32_t i = 0; i < pixel_count; ++i) {
-        pImpl_->writeDataBuffer(rgb666_bytes, 3);
-    }
+    uint32_t pixel_count = uint32_t(x1 - x0 + 1) * (y1 - y0 + 1);
+    pImpl_->beginWrite(x0, y0, x1, y1);
+    pImpl_->streamFill(rgb666_bytes, pixel_count);
 }
 
 // Fill rectangular area (RGB666 native - no conversion needed)
 void ILI9488Driver::fillAreaRGB666(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint32_t color666) {
     if (x0 > x1 || y0 > y1) return;
     
-    pImpl_->setWindow(x0, y0, x1, y1);
-    
     // 直接使用RGB666格式，无需转换
     uint8_t rgb666_bytes[3];
     rgb666_bytes[0] = (color666 >> 16) & 0xFC;  // 红色分量，保留高6位
     rgb666_bytes[1] = (color666 >> 8) & 0xFC;   // 绿色分量，保留高6位
     rgb666_bytes[2] = color666 & 0xFC;          // 蓝色分量，保留高6位
     
-    uint32_t pixel_count = (x1 - x0 + 1) * (y1 - y0 + 1);
-    
-    for (uint32_t i = 0; i < pixel_count; ++i) {
-        pImpl_->writeDataBuffer(rgb666_bytes, 3);
-    }
+    uint32_t pixel_count = uint32_t(x1 - x0 + 1) * (y1 - y0 + 1);
+    pImpl_->beginWrite(x0, y0, x1, y1);
+    pImpl_->streamFill(rgb666_bytes, pixel_count);
 }
 
 // Fill entire screen (RGB565)
@@ -462,13 +1331,41 @@ void ILI9488Driver::fillScreen(uint16_t color) {
     fillArea(0, 0, pImpl_->display_width_ - 1, pImpl_->display_height_ - 1, color);
 }
 
+// Fill entire screen (RGB888)
+void ILI9488Driver::fillScreenRGB24(uint32_t color) {
+    fillAreaRGB24(0, 0, pImpl_->display_width_ - 1, pImpl_->display_height_ - 1, color);
+}
+
 // Fill entire screen (RGB666 native)
 void ILI9488Driver::fillScreenRGB666(uint32_t color666) {
     fillAreaRGB666(0, 0, pImpl_->display_width_ - 1, pImpl_->display_height_ - 1, color666);
 }
 
+// Select the interface pixel format
+void ILI9488Driver::setColorMode(ColorMode mode) {
+    // Over SPI the panel accepts 18-bit or 3-bit pixels; RGB565/RGB888
+    // input is always converted, so those select the 18-bit format
+    ColorMode wire_mode = (mode == ColorMode::RGB111) ? ColorMode::RGB111 : ColorMode::RGB666;
+    if (!pImpl_->is_initialized_) {
+        // The SPI bus is not up yet; the init sequence sends this format
+        pImpl_->color_mode_ = wire_mode;
+        return;
+    }
+    const uint8_t pixfmt = (wire_mode == ColorMode::RGB111) ? 0x61 : 0x66;
+    pImpl_->writeCommandData(Commands::PIXFMT, &pixfmt, 1);
+    pImpl_->color_mode_ = wire_mode;
+}
+
+// Get the interface pixel format
+ColorMode ILI9488Driver::getColorMode() const {
+    return pImpl_->color_mode_;
+}
+
 // Set display rotation
 void ILI9488Driver::setRotation(Rotation rotation) {
+    // The scrolling area is defined in the old orientation's rows
+    resetVerticalScroll();
+    
     pImpl_->current_rotation_ = rotation;
     pImpl_->updateDimensions();
     
@@ -489,8 +1386,8 @@ void ILI9488Driver::setRotation(Rotation rotation) {
             break;
     }
     
-    pImpl_->writeCommand(Commands::MADCTL);
-    pImpl_->writeData(madctl_value);
+    pImpl_->writeCommandData(Commands::MADCTL, &madctl_value, 1);
+    pImpl_->invalidateWindow();
 }
 
 // Get current rotation
@@ -520,11 +1417,68 @@ void ILI9488Driver::setPartialMode(bool enable) {
 
 // Set partial display area
 void ILI9488Driver::setPartialArea(uint16_t /* x0 */, uint16_t y0, uint16_t /* x1 */, uint16_t y1) {
-    pImpl_->writeCommand(Commands::PTLAR);
-    pImpl_->writeData(y0 >> 8);
-    pImpl_->writeData(y0 & 0xFF);
-    pImpl_->writeData(y1 >> 8);
-    pImpl_->writeData(y1 & 0xFF);
+    const uint8_t rows[4] = {
+        uint8_t(y0 >> 8), uint8_t(y0 & 0xFF), uint8_t(y1 >> 8), uint8_t(y1 & 0xFF)
+    };
+    pImpl_->writeCommandData(Commands::PTLAR, rows, sizeof(rows));
+}
+
+// Define the vertical scrolling area
+bool ILI9488Driver::setVerticalScrollArea(uint16_t top_fixed, uint16_t bottom_fixed) {
+    Rotation rotation = pImpl_->current_rotation_;
+    if (rotation != Rotation::Portrait_0 && rotation != Rotation::Portrait_180) {
+        return false;
+    }
+    if (uint32_t(top_fixed) + bottom_fixed >= LCD_HEIGHT) {
+        return false;
+    }
+    
+    uint16_t height = LCD_HEIGHT - top_fixed - bottom_fixed;
+    pImpl_->writeScrollDefinition(top_fixed, height, bottom_fixed);
+    pImpl_->scroll_top_ = top_fixed;
+    pImpl_->scroll_height_ = height;
+    pImpl_->scroll_offset_ = 0;
+    pImpl_->writeScrollStart(0);
+    return true;
+}
+
+// Set the scroll offset within the scrolling area
+void ILI9488Driver::setVerticalScrollOffset(uint16_t offset) {
+    if (pImpl_->scroll_height_ == 0) return;
+    
+    pImpl_->scroll_offset_ = offset % pImpl_->scroll_height_;
+    pImpl_->writeScrollStart(pImpl_->scroll_offset_);
+}
+
+// Get the current scroll offset
+uint16_t ILI9488Driver::getVerticalScrollOffset() const {
+    return pImpl_->scroll_offset_;
+}
+
+// Whether a scrolling area is defined
+bool ILI9488Driver::isVerticalScrollActive() const {
+    return pImpl_->scroll_height_ != 0;
+}
+
+// Return to a non-scrolled full-screen display
+void ILI9488Driver::resetVerticalScroll() {
+    if (pImpl_->scroll_height_ == 0) return;
+    
+    pImpl_->scroll_top_ = 0;
+    pImpl_->scroll_height_ = 0;
+    pImpl_->scroll_offset_ = 0;
+    pImpl_->writeScrollDefinition(0, LCD_HEIGHT, 0);
+    pImpl_->writeScrollStart(0);
+}
+
+// Map a screen row to the memory row displayed there
+uint16_t ILI9488Driver::scrolledRow(uint16_t y) const {
+    uint16_t top = pImpl_->scroll_top_;
+    uint16_t height = pImpl_->scroll_height_;
+    if (height == 0 || y < top || y >= top + height) {
+        return y;
+    }
+    return top + (y - top + pImpl_->scroll_offset_) % height;
 }
 
 // Write data using DMA (non-blocking)
@@ -533,28 +1487,44 @@ bool ILI9488Driver::writeDMA(const uint8_t* data, size_t length) {
         return false;
     }
     
-    pImpl_->dma_busy_ = true;
-    
-    // Configure DMA transfer
-    dma_channel_config config = dma_channel_get_default_config(pImpl_->dma_channel_);
-    channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
-    channel_config_set_dreq(&config, spi_get_dreq(pImpl_->spi_inst_, true));
-    
-    pImpl_->setCS(false);
+    pImpl_->beginTransfer();
     pImpl_->setDC(true);
+    pImpl_->startDMA(data, length, true, true);
     
-    dma_channel_configure(
-        pImpl_->dma_channel_,
-        &config,
-        &spi_get_hw(pImpl_->spi_inst_)->dr,
-        data,
-        length,
-        true
-    );
+    return true;
+}
+
+// Enable panel readback on the given MISO pin
+bool ILI9488Driver::enableReadback(uint8_t pin_miso) {
+    if (!pImpl_->is_initialized_) return false;
+    // SPI RX pins are every fourth GPIO; the instance alternates every 8 pins
+    bool rx_pin = pin_miso < NUM_BANK0_GPIOS && (pin_miso & 3) == 0 &&
+                  ((pin_miso >> 3) & 1) == spi_get_index(pImpl_->spi_inst_);
+    if (!rx_pin) return false;
+    gpio_set_function(pin_miso, GPIO_FUNC_SPI);
+    pImpl_->miso_pin_ = pin_miso;
+    return true;
+}
+
+// Check whether panel readback is available
+bool ILI9488Driver::isReadbackEnabled() const {
+    return pImpl_->miso_pin_ >= 0;
+}
+
+// Read a window of panel memory as RGB565
+bool ILI9488Driver::readPixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t* colors) {
+    if (pImpl_->miso_pin_ < 0 || pImpl_->color_mode_ == ColorMode::RGB111) return false;
+    if (!colors || x0 > x1 || y0 > y1) return false;
     
+    pImpl_->readPixels(x0, y0, x1, y1, colors);
     return true;
 }
 
+// Check whether a DMA channel is available
+bool ILI9488Driver::isDMAAvailable() const {
+    return pImpl_->dma_channel_ >= 0;
+}
+
 // Check if DMA transfer is busy
 bool ILI9488Driver::isDMABusy() const {
     return pImpl_->dma_busy_;
@@ -562,9 +1532,65 @@ bool ILI9488Driver::isDMABusy() const {
 
 // Wait for DMA transfer to complete
 void ILI9488Driver::waitDMAComplete() {
-    while (pImpl_->dma_busy_) {
-        tight_loop_contents();
-    }
+    pImpl_->waitForDMA();
+}
+
+// Enable tearing-effect synchronized transfers
+bool ILI9488Driver::enableTearingSync(uint8_t pin_te, uint32_t min_pixels) {
+    if (!pImpl_->is_initialized_) return false;
+    return pImpl_->enableTearingSync(pin_te, min_pixels);
+}
+
+// Disable tearing-effect synchronized transfers
+void ILI9488Driver::disableTearingSync() {
+    pImpl_->disableTearingSync();
+}
+
+// Check whether TE synchronization is active
+bool ILI9488Driver::isTearingSyncEnabled() const {
+    return pImpl_->te_pin_ >= 0;
+}
+
+// Get TE timing and deferral counters
+TearingStats ILI9488Driver::getTearingStats() const {
+    TearingStats stats;
+    stats.frames = pImpl_->te_frames_;
+    stats.period_us = pImpl_->te_period_us_;
+    stats.deferred = pImpl_->te_deferred_;
+    return stats;
+}
+
+// Get bus traffic counters
+const BusStats& ILI9488Driver::getBusStats() const {
+    return pImpl_->stats_;
+}
+
+// Reset bus traffic counters
+void ILI9488Driver::resetBusStats() {
+    pImpl_->stats_ = BusStats{};
+}
+
+// Enable the LRU glyph cache
+void ILI9488Driver::enableGlyphCache(size_t budget_bytes) {
+    pImpl_->enableGlyphCache(budget_bytes);
+}
+
+// Disable the glyph cache and free its memory
+void ILI9488Driver::disableGlyphCache() {
+    pImpl_->disableGlyphCache();
+}
+
+// Get glyph cache counters
+GlyphCacheStats ILI9488Driver::getGlyphCacheStats() const {
+    return pImpl_->glyph_stats_;
+}
+
+// Reset glyph cache counters
+void ILI9488Driver::resetGlyphCacheStats() {
+    GlyphCacheStats& stats = pImpl_->glyph_stats_;
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.evictions = 0;
 }
 
 // Get display width (considering rotation)
@@ -601,19 +1627,47 @@ uint16_t ILI9488Driver::getStringWidth(std::string_view str) const {
 void ILI9488Driver::drawChar(uint16_t x, uint16_t y, char c, uint32_t color, uint32_t bg_color) {
     using namespace font;
     
-    const uint8_t* char_data = get_char_data(c);
+    if (x >= pImpl_->display_width_ || y >= pImpl_->display_height_) {
+        return;
+    }
     
-    for (uint8_t row = 0; row < FONT_HEIGHT; ++row) {
-        uint8_t byte = char_data[row];
-        for (uint8_t col = 0; col < FONT_WIDTH; ++col) {
-            bool pixel_is_set = (byte >> (7 - col)) & 0x01;
-            if (pixel_is_set) {
-                drawPixelRGB24(x + col, y + row, color);
-            } else {
-                drawPixelRGB24(x + col, y + row, bg_color);
-            }
+    uint8_t fg[3], bg[3];
+    pImpl_->rgb888ToRGB666Bytes(color, fg);
+    pImpl_->rgb888ToRGB666Bytes(bg_color, bg);
+    
+    // Clip the cell to the display edge
+    uint8_t columns = static_cast<uint8_t>(std::min<int>(FONT_WIDTH, pImpl_->display_width_ - x));
+    uint8_t rows = static_cast<uint8_t>(std::min<int>(FONT_HEIGHT, pImpl_->display_height_ - y));
+    
+    // A cached, unclipped glyph goes straight from the cache to DMA. A cell
+    // cut by the display edge reuses a cached glyph but never adds one, so
+    // it cannot evict glyphs that are drawn whole.
+    bool whole = columns == FONT_WIDTH && rows == FONT_HEIGHT;
+    const uint8_t* cached = whole ? pImpl_->lookupGlyph(c, fg, bg) : pImpl_->findGlyph(c, fg, bg);
+    if (cached && whole &&
+        pImpl_->color_mode_ == ColorMode::RGB666 && pImpl_->dma_channel_ >= 0) {
+        pImpl_->beginWrite(x, y, x + FONT_WIDTH - 1, y + FONT_HEIGHT - 1);
+        pImpl_->startDMA(cached, Impl::GLYPH_BYTES, true, true);
+        return;  // CS is released by the DMA completion handler
+    }
+    
+    // Otherwise build the clipped glyph in one RGB666 block and send it in one window
+    uint8_t* out = pImpl_->glyph_block_;
+    if (cached) {
+        for (uint8_t row = 0; row < rows; ++row) {
+            memcpy(out, cached + row * Impl::GLYPH_ROW_BYTES, columns * 3);
+            out += columns * 3;
+        }
+    } else {
+        const uint8_t* char_data = get_char_data(c);
+        for (uint8_t row = 0; row < rows; ++row) {
+            out = Impl::expandGlyphRow(char_data[row], columns, fg, bg, out);
         }
     }
+    
+    pImpl_->beginWrite(x, y, x + columns - 1, y + rows - 1);
+    pImpl_->writePixelData(pImpl_->glyph_block_, size_t(columns) * rows);
+    pImpl_->endWrite();
 }
 
 // Draw a string (C-style)
@@ -625,11 +1679,28 @@ void ILI9488Driver::drawString(uint16_t x, uint16_t y, const char* str, uint32_t
 void ILI9488Driver::drawString(uint16_t x, uint16_t y, std::string_view str, uint32_t color, uint32_t bg_color) {
     using namespace font;
     
+    uint8_t fg[3], bg[3];
+    pImpl_->rgb888ToRGB666Bytes(color, fg);
+    pImpl_->rgb888ToRGB666Bytes(bg_color, bg);
+    
+    // Printable ASCII is sent in runs, one window per run; other characters
+    // are skipped but still advance the cursor
     uint16_t current_x = x;
+    uint16_t run_x = x;
+    size_t run_start = 0;
+    size_t run_length = 0;
     
-    for (char c : str) {
+    for (size_t i = 0; i < str.size(); ++i) {
+        char c = str[i];
         if (c >= 32 && c <= 126) {  // Printable ASCII
-            drawChar(current_x, y, c, color, bg_color);
+            if (run_length == 0) {
+                run_x = current_x;
+                run_start = i;
+            }
+            ++run_length;
+        } else if (run_length > 0) {
+            pImpl_->drawTextRun(run_x, y, str.data() + run_start, run_length, fg, bg);
+            run_length = 0;
         }
         current_x += FONT_WIDTH;
         
@@ -638,6 +1709,10 @@ void ILI9488Driver::drawString(uint16_t x, uint16_t y, std::string_view str, uin
             break;
         }
     }
+    
+    if (run_length > 0) {
+        pImpl_->drawTextRun(run_x, y, str.data() + run_start, run_length, fg, bg);
+    }
 }
 
 } // namespace ili9488 
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "ili9488_image.hpp"
+
+namespace ili9488 {
+
+bool ImageDecoder::begin(const uint8_t* data, size_t size) {
+    *this = ImageDecoder{};
+    if (!data || size < HEADER_SIZE) return false;
+    if (data[0] != 'P' || data[1] != 'I' || data[2] != 'M' || data[3] != 'G') return false;
+    if (data[4] != VERSION || data[5] > uint8_t(Format::RLE_PAL4)) return false;
+
+    format_ = static_cast<Format>(data[5]);
+    width_ = uint16_t(data[6] | (data[7] << 8));
+    height_ = uint16_t(data[8] | (data[9] << 8));
+    palette_size_ = data[10];
+
+    size_t palette_bytes = size_t(palette_size_) * 3;
+    if (format_ == Format::RLE_PAL4 && (palette_size_ == 0 || palette_size_ > 16)) return false;
+    if (size < HEADER_SIZE + palette_bytes) return false;
+
+    palette_ = data + HEADER_SIZE;
+    pos_ = palette_ + palette_bytes;
+    end_ = data + size;
+    remaining_ = size_t(width_) * height_;
+    return true;
+}
+
+uint8_t ImageDecoder::next() {
+    if (pos_ == end_) {
+        error_ = true;
+        return 0;
+    }
+    return *pos_++;
+}
+
+void ImageDecoder::read(uint8_t* rgb666, size_t count) {
+    if (count > remaining_) {
+        // Past the last pixel: pad with black rather than read further
+        for (size_t i = remaining_ * 3; i < count * 3; ++i) {
+            rgb666[i] = 0;
+        }
+        count = remaining_;
+    }
+    remaining_ -= count;
+
+    if (format_ == Format::RLE_PAL4) {
+        readPAL4(rgb666, count);
+    } else {
+        readRGB666(rgb666, count);
+    }
+}
+
+void ImageDecoder::readRGB666(uint8_t* out, size_t count) {
+    uint8_t r = color_[0], g = color_[1], b = color_[2];
+
+    for (size_t i = 0; i < count; ++i) {
+        if (run_ > 0) {
+            --run_;
+        } else if (!error_) {
+            uint8_t op = next();
+            if (op == 0xFF) {
+                r = next() & 0x3F;
+                g = next() & 0x3F;
+                b = next() & 0x3F;
+            } else {
+                switch (op >> 6) {
+                    case 0:
+                        r = index_[op][0];
+                        g = index_[op][1];
+                        b = index_[op][2];
+                        break;
+                    case 1:
+                        r = (r + ((op >> 4) & 3) - 2) & 0x3F;
+                        g = (g + ((op >> 2) & 3) - 2) & 0x3F;
+                        b = (b + (op & 3) - 2) & 0x3F;
+                        break;
+                    case 2: {
+                        int dg = int(op & 0x3F) - 32;
+                        uint8_t rb = next();
+                        r = (r + dg + (rb >> 4) - 8) & 0x3F;
+                        g = (g + dg) & 0x3F;
+                        b = (b + dg + (rb & 0x0F) - 8) & 0x3F;
+                        break;
+                    }
+                    default:
+                        run_ = op & 0x3F;  // This pixel plus run_ more
+                        break;
+                }
+            }
+            if (op >> 6 != 3 || op == 0xFF) {
+                uint8_t* slot = index_[(r * 3 + g * 5 + b * 7) & 0x3F];
+                slot[0] = r;
+                slot[1] = g;
+                slot[2] = b;
+            }
+            if (error_) {
+                r = g = b = 0;
+            }
+        }
+
+        *out++ = uint8_t(r << 2);
+        *out++ = uint8_t(g << 2);
+        *out++ = uint8_t(b << 2);
+    }
+
+    color_[0] = r;
+    color_[1] = g;
+    color_[2] = b;
+}
+
+void ImageDecoder::readPAL4(uint8_t* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t index = run_index_;
+        if (run_ > 0) {
+            --run_;
+        } else {
+            if (literal_ == 0 && !error_) {
+                uint8_t op = next();
+                if (op & 0x80) {
+                    run_index_ = next() & 0x0F;
+                    run_ = op & 0x7F;  // This pixel plus run_ more
+                    index = run_index_;
+                } else {
+                    literal_ = uint8_t(op + 1);
+                    low_nibble_ = false;
+                }
+            }
+            if (literal_ > 0) {
+                if (low_nibble_) {
+                    index = literal_byte_ & 0x0F;
+                } else {
+                    literal_byte_ = next();
+                    index = literal_byte_ >> 4;
+                }
+                low_nibble_ = !low_nibble_;
+                --literal_;
+            }
+        }
+
+        if (index >= palette_size_) {
+            error_ = true;
+        }
+        if (error_) {
+            *out++ = 0;
+            *out++ = 0;
+            *out++ = 0;
+            continue;
+        }
+        const uint8_t* entry = palette_ + index * 3;
+        *out++ = uint8_t(entry[0] << 2);
+        *out++ = uint8_t(entry[1] << 2);
+        *out++ = uint8_t(entry[2] << 2);
+    }
+}
+
+} // namespace ili9488
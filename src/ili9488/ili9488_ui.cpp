@@ -6,6 +6,7 @@
 
 #include "ili9488_ui.hpp"
 #include "ili9488_colors.hpp"
+#include "polygon_raster.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -15,6 +16,7 @@ namespace ili9488 {
 // Constructor
 ILI9488_UI::ILI9488_UI(int16_t width, int16_t height) 
     : _width(width), _height(height), WIDTH(width), HEIGHT(height), rotation_(0) {
+    resetClip();
 }
 
 // Destructor  
@@ -22,14 +24,82 @@ ILI9488_UI::~ILI9488_UI() = default;
 
 // Drawing primitives with Adafruit GFX compatibility
 
+// Clip stack
+
+bool ILI9488_UI::pushClip(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (clip_depth_ >= CLIP_STACK_DEPTH) return false;
+    clip_stack_[clip_depth_++] = clip_;
+    
+    // Intersect; an empty result keeps x0 == x1 or y0 == y1 so nothing draws
+    clip_.x0 = static_cast<int16_t>(std::max<int>(clip_.x0, x));
+    clip_.y0 = static_cast<int16_t>(std::max<int>(clip_.y0, y));
+    clip_.x1 = static_cast<int16_t>(std::max<int>(clip_.x0, std::min<int>(clip_.x1, x + std::max<int16_t>(w, 0))));
+    clip_.y1 = static_cast<int16_t>(std::max<int>(clip_.y0, std::min<int>(clip_.y1, y + std::max<int16_t>(h, 0))));
+    return true;
+}
+
+void ILI9488_UI::popClip() {
+    if (clip_depth_ > 0) {
+        clip_ = clip_stack_[--clip_depth_];
+    }
+}
+
+void ILI9488_UI::resetClip() {
+    clip_ = {0, 0, WIDTH, HEIGHT};
+    clip_depth_ = 0;
+}
+
 void ILI9488_UI::drawPixel(int16_t x, int16_t y, uint16_t color) {
-    if (isValidCoordinate(x, y)) {
+    if (isInClip(x, y)) {
         writePixel(static_cast<uint16_t>(x), static_cast<uint16_t>(y), color);
     }
 }
 
+void ILI9488_UI::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t j = y; j < y + h; j++) {
+        for (int16_t i = x; i < x + w; i++) {
+            writePixel(static_cast<uint16_t>(i), static_cast<uint16_t>(j), color);
+        }
+    }
+}
+
+void ILI9488_UI::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    writeFillRect(x, y, w, 1, color);
+}
+
+void ILI9488_UI::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    writeFillRect(x, y, 1, h, color);
+}
+
 void ILI9488_UI::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
-    bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+    if (!isClipVisible(std::min(x0, x1), std::min(y0, y1),
+                       std::abs(x1 - x0) + 1, std::abs(y1 - y0) + 1)) {
+        return;
+    }
+    
+    // Lengths and error terms are kept in int32: int16 endpoints can span up to 65535 pixels
+    bool steep = std::abs(int32_t(y1) - y0) > std::abs(int32_t(x1) - x0);
+    auto span = [&](int32_t minor, int32_t start, int32_t end) {
+        // Trim to the int16 range before handing over; the fast line calls clip the rest
+        start = std::max<int32_t>(start, 0);
+        end = std::min<int32_t>(end, INT16_MAX);
+        if (start >= end) return;
+        if (steep) {
+            drawFastVLine(static_cast<int16_t>(minor), static_cast<int16_t>(start),
+                          static_cast<int16_t>(end - start), color);
+        } else {
+            drawFastHLine(static_cast<int16_t>(start), static_cast<int16_t>(minor),
+                          static_cast<int16_t>(end - start), color);
+        }
+    };
+
+    if (x0 == x1 || y0 == y1) {
+        steep = x0 == x1;
+        int32_t a = steep ? y0 : x0;
+        int32_t b = steep ? y1 : x1;
+        span(steep ? x0 : y0, std::min(a, b), std::max(a, b) + 1);
+        return;
+    }
     
     if (steep) {
         swap(x0, y0);
@@ -41,45 +111,58 @@ void ILI9488_UI::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16
         swap(y0, y1);
     }
     
-    int16_t dx = x1 - x0;
-    int16_t dy = std::abs(y1 - y0);
-    int16_t err = dx / 2;
-    int16_t ystep = (y0 < y1) ? 1 : -1;
+    int32_t dx = int32_t(x1) - x0;
+    int32_t dy = std::abs(int32_t(y1) - y0);
+    int32_t err = dx / 2;
+    int32_t ystep = (y0 < y1) ? 1 : -1;
+    int32_t y = y0;
+    int32_t run_start = x0;
     
-    for (; x0 <= x1; x0++) {
-        if (steep) {
-            drawPixel(y0, x0, color);
-        } else {
-            drawPixel(x0, y0, color);
-        }
-        
+    // Pixels sharing a minor-axis coordinate form one span
+    for (int32_t x = x0; x <= x1; x++) {
         err -= dy;
-        if (err < 0) {
-            y0 += ystep;
+        if (err < 0 || x == x1) {
+            span(y, run_start, x + 1);
+            run_start = x + 1;
+            y += ystep;
             err += dx;
         }
     }
 }
 
 void ILI9488_UI::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
-    drawLine(x, y, x, y + h - 1, color);
+    if (x < clip_.x0 || x >= clip_.x1 || h <= 0) return;
+    int16_t y1 = static_cast<int16_t>(std::min<int>(y + h, clip_.y1));
+    if (y < clip_.y0) y = clip_.y0;
+    if (y >= y1) return;
+    writeFastVLine(x, y, y1 - y, color);
 }
 
 void ILI9488_UI::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
-    drawLine(x, y, x + w - 1, y, color);
+    if (y < clip_.y0 || y >= clip_.y1 || w <= 0) return;
+    int16_t x1 = static_cast<int16_t>(std::min<int>(x + w, clip_.x1));
+    if (x < clip_.x0) x = clip_.x0;
+    if (x >= x1) return;
+    writeFastHLine(x, y, x1 - x, color);
 }
 
 void ILI9488_UI::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!isClipVisible(x, y, w, h)) return;
     drawFastHLine(x, y, w, color);
-    drawFastHLine(x, y + h - 1, w, color);
-    drawFastVLine(x, y, h, color);
-    drawFastVLine(x + w - 1, y, h, color);
+    if (h > 1) drawFastHLine(x, y + h - 1, w, color);
+    // Sides without the corners already drawn by the horizontal edges
+    drawFastVLine(x, y + 1, h - 2, color);
+    if (w > 1) drawFastVLine(x + w - 1, y + 1, h - 2, color);
 }
 
 void ILI9488_UI::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-    for (int16_t i = x; i < x + w; i++) {
-        drawFastVLine(i, y, h, color);
-    }
+    if (w <= 0 || h <= 0) return;
+    int16_t x1 = static_cast<int16_t>(std::min<int>(x + w, clip_.x1));
+    int16_t y1 = static_cast<int16_t>(std::min<int>(y + h, clip_.y1));
+    if (x < clip_.x0) x = clip_.x0;
+    if (y < clip_.y0) y = clip_.y0;
+    if (x >= x1 || y >= y1) return;
+    writeFillRect(x, y, x1 - x, y1 - y, color);
 }
 
 void ILI9488_UI::fillScreen(uint16_t color) {
@@ -87,6 +170,8 @@ void ILI9488_UI::fillScreen(uint16_t color) {
 }
 
 void ILI9488_UI::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    if (!isClipVisible(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1)) return;
+    
     int16_t f = 1 - r;
     int16_t ddF_x = 1;
     int16_t ddF_y = -2 * r;
@@ -120,6 +205,7 @@ void ILI9488_UI::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
 }
 
 void ILI9488_UI::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    if (!isClipVisible(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1)) return;
     drawFastVLine(x0, y0 - r, 2 * r + 1, color);
     fillCircleHelper(x0, y0, r, 3, 0, color);
 }
@@ -160,6 +246,12 @@ void ILI9488_UI::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cor
 }
 
 void ILI9488_UI::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    int16_t min_x = std::min({x0, x1, x2});
+    int16_t min_y = std::min({y0, y1, y2});
+    if (!isClipVisible(min_x, min_y, std::max({x0, x1, x2}) - min_x + 1,
+                       std::max({y0, y1, y2}) - min_y + 1)) {
+        return;
+    }
     drawLine(x0, y0, x1, y1, color);
     drawLine(x1, y1, x2, y2, color);
     drawLine(x2, y2, x0, y0, color);
@@ -168,6 +260,13 @@ void ILI9488_UI::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, in
 void ILI9488_UI::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
     int16_t a, b, y, last;
     
+    int16_t min_x = std::min({x0, x1, x2});
+    int16_t min_y = std::min({y0, y1, y2});
+    if (!isClipVisible(min_x, min_y, std::max({x0, x1, x2}) - min_x + 1,
+                       std::max({y0, y1, y2}) - min_y + 1)) {
+        return;
+    }
+    
     // Sort coordinates by Y order (y2 >= y1 >= y0)
     if (y0 > y1) {
         swap(y0, y1);
@@ -242,6 +341,7 @@ void ILI9488_UI::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, in
 }
 
 void ILI9488_UI::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    if (!isClipVisible(x, y, w, h)) return;
     int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
     if (r > max_radius) r = max_radius;
     // smarter version
@@ -257,6 +357,7 @@ void ILI9488_UI::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16
 }
 
 void ILI9488_UI::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    if (!isClipVisible(x, y, w, h)) return;
     int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
     if (r > max_radius) r = max_radius;
     // smarter version
@@ -306,8 +407,7 @@ void ILI9488_UI::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
 }
 
 void ILI9488_UI::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y) {
-    if ((x >= WIDTH) || (y >= HEIGHT) ||
-        ((x + 6 * size_x - 1) < 0) || ((y + 8 * size_y - 1) < 0))
+    if (!isClipVisible(x, y, 6 * size_x, 8 * size_y))
         return;
     
     // For now, just draw a simple character placeholder
@@ -339,7 +439,16 @@ void ILI9488_UI::drawString(int16_t x, int16_t y, const char* str, uint16_t colo
     }
 }
 
+void ILI9488_UI::writeRotation(uint8_t rotation) {
+    (void)rotation;  // No hardware to program
+}
+
 void ILI9488_UI::setRotation(uint8_t rotation) {
+    writeRotation(rotation & 3);
+    setRotationState(rotation);
+}
+
+void ILI9488_UI::setRotationState(uint8_t rotation) {
     rotation_ = rotation & 3;
     switch (rotation_) {
         case 0:
@@ -353,11 +462,22 @@ void ILI9488_UI::setRotation(uint8_t rotation) {
             HEIGHT = _width;
             break;
     }
+    resetClip();
 }
 
 void ILI9488_UI::drawPolygon(const int16_t* x_points, const int16_t* y_points, uint8_t count, uint16_t color) {
     if (count < 3) return;
     
+    int16_t min_x = x_points[0], max_x = x_points[0];
+    int16_t min_y = y_points[0], max_y = y_points[0];
+    for (uint8_t i = 1; i < count; i++) {
+        min_x = std::min(min_x, x_points[i]);
+        max_x = std::max(max_x, x_points[i]);
+        min_y = std::min(min_y, y_points[i]);
+        max_y = std::max(max_y, y_points[i]);
+    }
+    if (!isClipVisible(min_x, min_y, max_x - min_x + 1, max_y - min_y + 1)) return;
+    
     for (uint8_t i = 0; i < count; i++) {
         uint8_t next = (i + 1) % count;
         drawLine(x_points[i], y_points[i], x_points[next], y_points[next], color);
@@ -365,25 +485,36 @@ void ILI9488_UI::drawPolygon(const int16_t* x_points, const int16_t* y_points, u
 }
 
 void ILI9488_UI::fillPolygon(const int16_t* x_points, const int16_t* y_points, uint8_t count, uint16_t color) {
-    // Simple polygon fill using scanline algorithm
-    // This is a basic implementation
     if (count < 3) return;
     
-    // For now, just draw the outline
-    drawPolygon(x_points, y_points, count, color);
+    // Edge-table scanline fill; only rows inside the clip are walked and
+    // each span goes out through writeFastHLine()
+    polygon_raster::fill_polygon(x_points, y_points, count, clip_.y0, clip_.y1,
+                                 [&](int16_t y, int16_t x0, int16_t x1) {
+                                     drawFastHLine(x0, y, x1 - x0 + 1, color);
+                                 });
 }
 
 void ILI9488_UI::drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* bitmap) {
-    for (int16_t j = 0; j < h; j++) {
-        for (int16_t i = 0; i < w; i++) {
-            drawPixel(x + i, y + j, bitmap[j * w + i]);
+    // Visit only the rows and columns inside the clip
+    int16_t j0 = std::max<int>(clip_.y0 - y, 0);
+    int16_t j1 = std::min<int>(clip_.y1 - y, h);
+    int16_t i0 = std::max<int>(clip_.x0 - x, 0);
+    int16_t i1 = std::min<int>(clip_.x1 - x, w);
+    for (int16_t j = j0; j < j1; j++) {
+        for (int16_t i = i0; i < i1; i++) {
+            writePixel(x + i, y + j, bitmap[j * w + i]);
         }
     }
 }
 
 void ILI9488_UI::drawBitmapRGB24(int16_t x, int16_t y, int16_t w, int16_t h, const uint32_t* bitmap) {
-    for (int16_t j = 0; j < h; j++) {
-        for (int16_t i = 0; i < w; i++) {
+    int16_t j0 = std::max<int>(clip_.y0 - y, 0);
+    int16_t j1 = std::min<int>(clip_.y1 - y, h);
+    int16_t i0 = std::max<int>(clip_.x0 - x, 0);
+    int16_t i1 = std::min<int>(clip_.x1 - x, w);
+    for (int16_t j = j0; j < j1; j++) {
+        for (int16_t i = i0; i < i1; i++) {
             writePixelRGB24(x + i, y + j, bitmap[j * w + i]);
         }
     }
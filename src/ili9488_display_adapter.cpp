@@ -0,0 +1,224 @@
+/**
+ * @file ili9488_display_adapter.cpp
+ * @brief ILI9488显示驱动适配器实现
+ */
+
+#include "ili9488_display_adapter.hpp"
+#include "ili9488/ili9488_font.hpp"
+#include "pin_config.hpp"
+
+#include <cstdio>
+#include <algorithm>
+#include "pico/stdlib.h"
+
+namespace usb2ttl {
+
+using namespace ili9488;
+using namespace ili9488_colors;
+using HardwareConfig = pin_config::ILI9488Config;  // 使用统一配置
+
+ILI9488DisplayAdapter::ILI9488DisplayAdapter() {
+    ili9488_driver_ = std::make_unique<ILI9488Driver>(
+        HardwareConfig::spi_instance(),
+        HardwareConfig::pin_dc,
+        HardwareConfig::pin_rst,
+        HardwareConfig::pin_cs,
+        HardwareConfig::pin_sck,
+        HardwareConfig::pin_mosi,
+        HardwareConfig::pin_bl
+    );
+    
+    gfx_ = std::make_unique<GFX>(
+        *ili9488_driver_, HardwareConfig::width, HardwareConfig::height
+    );
+    
+    width_ = HardwareConfig::width;
+    height_ = HardwareConfig::height;
+    font_width_ = font::FONT_WIDTH;
+    font_height_ = font::FONT_HEIGHT;
+    text_offset_x_ = 5;
+    text_offset_y_ = 5;
+}
+
+bool ILI9488DisplayAdapter::initialize() {
+    printf("Initializing ILI9488 display...\n");
+    
+    if (!ili9488_driver_->initialize()) {
+        printf("Failed to initialize ILI9488 driver!\n");
+        return false;
+    }
+    
+    ili9488_driver_->setRotation(Rotation::Portrait_180);
+    gfx_->syncRotation();  // GFX的旋转与驱动的MADCTL保持一致
+    ili9488_driver_->fillScreenRGB666(rgb666::BLACK);
+    
+    // 接了MISO时允许回读显存，GFX的半透明绘制以屏幕实际内容为底色
+    if (HardwareConfig::pin_miso != 255 &&
+        !ili9488_driver_->enableReadback(HardwareConfig::pin_miso)) {
+        printf("GPIO %u is not an RX pin of the display SPI, readback disabled\n",
+               HardwareConfig::pin_miso);
+    }
+    
+    // 编辑器和状态栏反复绘制相同颜色的字符，缓存展开后的字形（16KB，约40个）
+    ili9488_driver_->enableGlyphCache(16 * 1024);
+    
+    // 文本行区域设为硬件滚动区，高度取整行数，保证文本行不会跨越回绕处
+    scroll_top_ = text_offset_y_;
+    scroll_height_ = get_max_text_rows() * font_height_;
+    text_scroll_active();
+    sleep_ms(100);
+    ili9488_driver_->setBacklight(true);
+    
+    printf("ILI9488 display initialized successfully!\n");
+    return true;
+}
+
+void ILI9488DisplayAdapter::clear_screen(std::uint32_t color) {
+    // 清屏后回到未滚动状态，直接通过GFX绘制的界面不受滚动映射影响
+    if (ili9488_driver_->isVerticalScrollActive()) {
+        ili9488_driver_->setVerticalScrollOffset(0);
+    }
+    // 整屏单色由区域填充直接发送（DMA），帧缓冲同步清空且不产生脏块
+    if (framebuffer_) {
+        framebuffer_->clear(color);
+    }
+    ili9488_driver_->fillScreenRGB666(color);
+}
+
+void ILI9488DisplayAdapter::enable_framebuffer(bool enable) {
+    if (enable == has_framebuffer()) return;
+    
+    if (enable) {
+        framebuffer_ = std::make_unique<ILI9488Framebuffer>(get_width(), get_height());
+        ili9488_driver_->fillScreenRGB666(rgb666::BLACK);
+    } else {
+        framebuffer_->flush(*ili9488_driver_);
+        framebuffer_.reset();
+    }
+}
+
+void ILI9488DisplayAdapter::fill_memory_rect(int x, int y, int width, int height, std::uint32_t color) {
+    if (framebuffer_) {
+        framebuffer_->fill_rect(x, y, width, height, color);
+    } else {
+        ili9488_driver_->fillAreaRGB666(x, y, x + width - 1, y + height - 1, color);
+    }
+}
+
+void ILI9488DisplayAdapter::fill_rect(int x, int y, int width, int height, std::uint32_t color) {
+    if (width <= 0 || height <= 0) return;
+    
+    if (!text_scroll_active()) {
+        fill_memory_rect(x, y, width, height, color);
+        return;
+    }
+    
+    // 按滚动区域上方、内部、下方三段分别处理
+    int scroll_bottom = scroll_top_ + scroll_height_;
+    int y_end = y + height;
+    if (y < scroll_top_) {
+        fill_memory_rect(x, y, width, std::min(y_end, scroll_top_) - y, color);
+    }
+    int inner_top = std::max(y, scroll_top_);
+    int inner_end = std::min(y_end, scroll_bottom);
+    if (inner_top < inner_end) {
+        fill_scrolled_rect(x, inner_top, width, inner_end - inner_top, color);
+    }
+    if (y_end > scroll_bottom) {
+        int top = std::max(y, scroll_bottom);
+        fill_memory_rect(x, top, width, y_end - top, color);
+    }
+}
+
+void ILI9488DisplayAdapter::fill_scrolled_rect(int x, int y, int width, int height, std::uint32_t color) {
+    int mapped = ili9488_driver_->scrolledRow(y);
+    int rows_to_wrap = scroll_top_ + scroll_height_ - mapped;
+    int first = std::min(height, rows_to_wrap);
+    fill_memory_rect(x, mapped, width, first, color);
+    if (first < height) {
+        fill_memory_rect(x, scroll_top_, width, height - first, color);
+    }
+}
+
+void ILI9488DisplayAdapter::draw_text(const std::string& text, int x, int y, 
+                                      std::uint32_t fg_color, std::uint32_t bg_color) {
+    // rgb666常量与fill_rect相同，按0xRRGGBB字节对齐存放（低2位为0），可直接作为RGB888使用
+    uint32_t fg_rgb888 = fg_color;
+    uint32_t bg_rgb888 = bg_color;
+    // 文本按首行映射；编辑器的文本行与滚动区域对齐，不会跨越回绕处
+    uint16_t mapped_y = y >= 0 ? ili9488_driver_->scrolledRow(y) : y;
+    if (framebuffer_) {
+        framebuffer_->draw_text(text, x, mapped_y, fg_color, bg_color);
+        return;
+    }
+    ili9488_driver_->drawString(x, mapped_y, text.c_str(), fg_rgb888, bg_rgb888);
+}
+
+void ILI9488DisplayAdapter::draw_char(char ch, int x, int y, std::uint32_t fg_color, std::uint32_t bg_color) {
+    uint32_t fg_rgb888 = fg_color;
+    uint32_t bg_rgb888 = bg_color;
+    uint16_t mapped_y = y >= 0 ? ili9488_driver_->scrolledRow(y) : y;
+    if (framebuffer_) {
+        framebuffer_->draw_char(ch, x, mapped_y, fg_color, bg_color);
+        return;
+    }
+    ili9488_driver_->drawChar(x, mapped_y, ch, fg_rgb888, bg_rgb888);
+}
+
+void ILI9488DisplayAdapter::draw_rect(int x, int y, int width, int height, std::uint32_t color) {
+    if (width <= 0 || height <= 0) return;
+    
+    // 四条边各为一次区域填充，并经过滚动映射
+    fill_rect(x, y, width, 1, color);
+    fill_rect(x, y + height - 1, width, 1, color);
+    fill_rect(x, y, 1, height, color);
+    fill_rect(x + width - 1, y, 1, height, color);
+}
+
+void ILI9488DisplayAdapter::set_backlight(float brightness) {
+    if (brightness <= 0.0f) {
+        ili9488_driver_->setBacklight(false);
+    } else {
+        ili9488_driver_->setBacklight(true);
+    }
+}
+
+void ILI9488DisplayAdapter::refresh() {
+    // 立即模式下驱动直接刷新；启用帧缓冲时发送本帧的脏块
+    if (framebuffer_) {
+        last_flush_ = framebuffer_->flush(*ili9488_driver_);
+    }
+}
+
+int ILI9488DisplayAdapter::get_width() const { return ili9488_driver_->getWidth(); }
+int ILI9488DisplayAdapter::get_height() const { return ili9488_driver_->getHeight(); }
+int ILI9488DisplayAdapter::get_font_width() const { return font_width_; }
+int ILI9488DisplayAdapter::get_font_height() const { return font_height_; }
+
+int ILI9488DisplayAdapter::get_max_text_rows() const {
+    return (height_ - text_offset_y_ - STATUS_BAR_HEIGHT) / font_height_;
+}
+
+bool ILI9488DisplayAdapter::text_scroll_active() {
+    if (ili9488_driver_->isVerticalScrollActive()) {
+        return true;
+    }
+    return ili9488_driver_->setVerticalScrollArea(
+        scroll_top_, get_height() - scroll_top_ - scroll_height_);
+}
+
+bool ILI9488DisplayAdapter::scroll_text_rows(int rows) {
+    if (!text_scroll_active()) {
+        return false;
+    }
+    
+    int offset = ili9488_driver_->getVerticalScrollOffset() + rows * font_height_;
+    offset %= scroll_height_;
+    if (offset < 0) {
+        offset += scroll_height_;
+    }
+    ili9488_driver_->setVerticalScrollOffset(static_cast<uint16_t>(offset));
+    return true;
+}
+
+} // namespace usb2ttl
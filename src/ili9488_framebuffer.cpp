@@ -0,0 +1,178 @@
+/**
+ * @file ili9488_framebuffer.cpp
+ * @brief ILI9488离屏帧缓冲实现
+ */
+
+#include "ili9488_framebuffer.hpp"
+#include "ili9488/ili9488_font.hpp"
+
+#include <algorithm>
+
+namespace usb2ttl {
+
+ILI9488Framebuffer::ILI9488Framebuffer(int width, int height)
+    : width_(width)
+    , height_(height)
+    , tiles_x_((width + TILE_SIZE - 1) / TILE_SIZE)
+    , tiles_y_((height + TILE_SIZE - 1) / TILE_SIZE)
+    , pixels_((width + 1) / 2 * height, 0)
+    , dirty_((tiles_x_ * tiles_y_ + 31) / 32, 0) {
+    clear(ili9488_colors::rgb666::BLACK);
+}
+
+void ILI9488Framebuffer::clear(std::uint32_t color) {
+    palette_[0] = color & 0xFCFCFC;
+    palette_size_ = 1;
+    std::fill(pixels_.begin(), pixels_.end(), 0);
+    std::fill(dirty_.begin(), dirty_.end(), 0);
+    bytes_drawn_ = 0;
+}
+
+std::uint8_t ILI9488Framebuffer::palette_index(std::uint32_t color) {
+    color &= 0xFCFCFC;
+    for (int i = 0; i < palette_size_; ++i) {
+        if (palette_[i] == color) {
+            return static_cast<std::uint8_t>(i);
+        }
+    }
+    if (palette_size_ < PALETTE_SIZE) {
+        palette_[palette_size_] = color;
+        return static_cast<std::uint8_t>(palette_size_++);
+    }
+
+    // 调色板已满，使用最接近的颜色
+    int best = 0;
+    std::uint32_t best_distance = UINT32_MAX;
+    for (int i = 0; i < palette_size_; ++i) {
+        int dr = int((palette_[i] >> 16) & 0xFF) - int((color >> 16) & 0xFF);
+        int dg = int((palette_[i] >> 8) & 0xFF) - int((color >> 8) & 0xFF);
+        int db = int(palette_[i] & 0xFF) - int(color & 0xFF);
+        std::uint32_t distance = std::uint32_t(dr * dr + dg * dg + db * db);
+        if (distance < best_distance) {
+            best_distance = distance;
+            best = i;
+        }
+    }
+    return static_cast<std::uint8_t>(best);
+}
+
+void ILI9488Framebuffer::mark_tile(int tx, int ty) {
+    int bit = ty * tiles_x_ + tx;
+    dirty_[bit / 32] |= 1u << (bit % 32);
+}
+
+bool ILI9488Framebuffer::is_tile_dirty(int tx, int ty) const {
+    int bit = ty * tiles_x_ + tx;
+    return (dirty_[bit / 32] >> (bit % 32)) & 1u;
+}
+
+void ILI9488Framebuffer::set_pixel(int x, int y, std::uint8_t index) {
+    std::uint8_t& cell = pixels_[y * ((width_ + 1) / 2) + x / 2];
+    int shift = (x & 1) ? 0 : 4;
+    if (((cell >> shift) & 0x0F) == index) {
+        return;  // 与当前内容相同，不产生流量
+    }
+    cell = static_cast<std::uint8_t>((cell & ~(0x0F << shift)) | (index << shift));
+    mark_tile(x / TILE_SIZE, y / TILE_SIZE);
+}
+
+void ILI9488Framebuffer::fill_rect(int x, int y, int width, int height, std::uint32_t color) {
+    int x0 = std::max(x, 0);
+    int y0 = std::max(y, 0);
+    int x1 = std::min(x + width, width_);
+    int y1 = std::min(y + height, height_);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    bytes_drawn_ += std::uint32_t(x1 - x0) * (y1 - y0) * 3;
+    std::uint8_t index = palette_index(color);
+    for (int py = y0; py < y1; ++py) {
+        for (int px = x0; px < x1; ++px) {
+            set_pixel(px, py, index);
+        }
+    }
+}
+
+void ILI9488Framebuffer::draw_char(char ch, int x, int y, std::uint32_t fg_color, std::uint32_t bg_color) {
+    using namespace font;
+
+    std::uint8_t fg = palette_index(fg_color);
+    std::uint8_t bg = palette_index(bg_color);
+    const std::uint8_t* glyph = get_char_data(ch);
+
+    int x1 = std::min(x + int(FONT_WIDTH), width_);
+    int y1 = std::min(y + int(FONT_HEIGHT), height_);
+    if (x >= x1 || y >= y1 || x < 0 || y < 0) return;
+
+    bytes_drawn_ += std::uint32_t(x1 - x) * (y1 - y) * 3;
+    for (int py = y; py < y1; ++py) {
+        std::uint8_t bits = glyph[py - y];
+        for (int px = x; px < x1; ++px) {
+            set_pixel(px, py, (bits & (0x80 >> (px - x))) ? fg : bg);
+        }
+    }
+}
+
+void ILI9488Framebuffer::draw_text(const std::string& text, int x, int y,
+                                   std::uint32_t fg_color, std::uint32_t bg_color) {
+    int cursor = x;
+    for (char ch : text) {
+        if (cursor >= width_) break;
+        if (ch >= 32 && ch <= 126) {
+            draw_char(ch, cursor, y, fg_color, bg_color);
+        }
+        cursor += font::FONT_WIDTH;
+    }
+}
+
+bool ILI9488Framebuffer::is_dirty() const {
+    return std::any_of(dirty_.begin(), dirty_.end(), [](std::uint32_t w) { return w != 0; });
+}
+
+void ILI9488Framebuffer::mark_all_dirty() {
+    for (int ty = 0; ty < tiles_y_; ++ty) {
+        for (int tx = 0; tx < tiles_x_; ++tx) {
+            mark_tile(tx, ty);
+        }
+    }
+}
+
+ILI9488Framebuffer::FlushStats ILI9488Framebuffer::flush(ili9488::ILI9488Driver& driver) {
+    FlushStats stats;
+    stats.bytes_drawn = bytes_drawn_;
+    bytes_drawn_ = 0;
+
+    const int row_bytes = (width_ + 1) / 2;
+    for (int ty = 0; ty < tiles_y_; ++ty) {
+        int tx = 0;
+        while (tx < tiles_x_) {
+            if (!is_tile_dirty(tx, ty)) {
+                ++tx;
+                continue;
+            }
+
+            // 合并同一行中相邻的脏块为一个窗口
+            int first = tx;
+            while (tx < tiles_x_ && is_tile_dirty(tx, ty)) {
+                ++tx;
+            }
+            int x0 = first * TILE_SIZE;
+            int x1 = std::min(tx * TILE_SIZE, width_);
+            int y0 = ty * TILE_SIZE;
+            int y1 = std::min(y0 + TILE_SIZE, height_);
+            size_t count = size_t(x1 - x0) * (y1 - y0);
+
+            // 驱动逐行查调色板展开为RGB666，不需要额外的RGB中转缓冲
+            driver.writePalette4Pixels(x0, y0, x1 - 1, y1 - 1,
+                                       &pixels_[y0 * row_bytes + x0 / 2], row_bytes, x0 & 1,
+                                       palette_, palette_size_);
+            stats.bytes_sent += std::uint32_t(count) * 3;
+            stats.tiles_sent += tx - first;
+            ++stats.windows;
+        }
+    }
+
+    std::fill(dirty_.begin(), dirty_.end(), 0);
+    return stats;
+}
+
+} // namespace usb2ttl
@@ -1,6 +1,7 @@
 #include "st73xx_ui.hpp"
 #include <cstdlib>
 #include "gfx_colors.hpp"
+#include "polygon_raster.hpp"
 
 #define ABS_DIFF(x, y) (((x) > (y))? ((x) - (y)) : ((y) - (x)))
 
@@ -286,41 +287,13 @@ void ST73XX_UI::drawPolygon(const int16_t *x, const int16_t *y, uint8_t sides, u
 
 void ST73XX_UI::drawFilledPolygon(const int16_t *vx, const int16_t *vy, uint8_t sides, uint16_t color) {
     if (sides < 3) return;
-    int16_t i, j, miny, maxy, x1, y1, x2, y2, ind1, ind2;
-    miny = vy[0]; maxy = vy[0];
-    for (i = 1; i < sides; i++) {
-        if (vy[i] < miny) miny = vy[i];
-        if (vy[i] > maxy) maxy = vy[i];
-    }
-    int16_t *nodeX = new int16_t[sides];
-    for (int16_t y = miny; y <= maxy; y++) {
-        int nodes = 0;
-        j = sides - 1;
-        for (i = 0; i < sides; i++) {
-            y1 = vy[i]; y2 = vy[j];
-            if (((y1 <= y) && (y2 > y)) || ((y2 <= y) && (y1 > y))) {
-                x1 = vx[i]; x2 = vx[j];
-                nodeX[nodes++] = (int16_t)(x1 + (float)(y - y1) / (y2 - y1) * (x2 - x1));
-            }
-            j = i;
-        }
-        for(i=0; i<nodes-1; ++i) {
-            for(j=0; j<nodes-i-1; ++j) {
-                if(nodeX[j] > nodeX[j+1]) {
-                    value_interchange(nodeX[j], nodeX[j+1]);
-                }
-            }
-        }
-        for (i = 0; i < nodes; i += 2) {
-            if (nodeX[i] >= WIDTH) break;
-            if (nodeX[i+1] > 0) {
-                if (nodeX[i] < 0) nodeX[i] = 0;
-                if (nodeX[i+1] > WIDTH) nodeX[i+1] = WIDTH;
-                drawFastHLine(nodeX[i], y, nodeX[i+1] - nodeX[i] + 1, color);
-            }
-        }
-    }
-    delete[] nodeX;
+    // 与ILI9488共用的边表扫描线填充，每段水平线交给drawFastHLine写入帧缓冲
+    polygon_raster::fill_polygon(vx, vy, sides, 0, HEIGHT, [&](int16_t y, int16_t a, int16_t b) {
+        if (a >= WIDTH || b < 0) return;
+        if (a < 0) a = 0;
+        if (b >= WIDTH) b = WIDTH - 1;
+        drawFastHLine(a, y, b - a + 1, color);
+    });
 }
 
 void ST73XX_UI::fillScreen(uint16_t color) {
@@ -2,12 +2,13 @@
 #include <fstream>
 #include <algorithm>
 #include <iostream>
+#include <cstdlib>
 
 namespace usb2ttl {
 
 TextEditor::TextEditor(std::shared_ptr<DisplayDriver> display)
     : lines_({""}), cursor_row_(0), cursor_col_(0), insert_mode_(true),
-      max_lines_(80), last_updated_row_(-1),
+      max_lines_(80), last_updated_row_(-1), top_row_(0),
       unsaved_changes_(false), input_frozen_(false), display_(display) {
     // 动态计算每行最大字符数
     if (display_) {
@@ -42,6 +43,7 @@ void TextEditor::clear_screen() {
     cursor_row_ = 0;
     cursor_col_ = 0;
     last_updated_row_ = -1;
+    top_row_ = 0;
     unsaved_changes_ = false;
     input_frozen_ = false;
     refresh_display();
@@ -78,6 +80,9 @@ void TextEditor::insert_char(char ch) {
                 // 检查是否需要冻结输入
                 check_and_freeze_input();
                 
+                // 光标移出屏幕时先滚动
+                ensure_cursor_visible();
+                
                 // 局部刷新：只绘制新字符
                 draw_char_at_position(ch, cursor_row_, 0);
                 unsaved_changes_ = true;
@@ -93,7 +98,8 @@ void TextEditor::insert_char(char ch) {
         line.insert(cursor_col_, 1, ch);
         
         // 局部刷新：只绘制新字符和后续字符
-        auto pos = display_->calculate_text_position(cursor_col_, cursor_row_);
+        ensure_cursor_visible();
+        auto pos = display_->calculate_text_position(cursor_col_, cursor_row_ - top_row_);
         
         // 清除从当前位置到行末的区域
         int remaining_width = (max_length_ - cursor_col_) * display_->get_font_width();
@@ -163,9 +169,14 @@ void TextEditor::newline() {
     // 检查是否需要冻结输入
     check_and_freeze_input();
     
-    // 局部刷新：重新绘制当前行和新行
+    // 光标移出屏幕时先滚动，新露出的行（即当前行）由滚动处理重绘
+    bool scrolled = ensure_cursor_visible();
+    
+    // 局部刷新：上一行在光标处被截断，需要重绘；当前行只在未滚动时重绘
     refresh_line(cursor_row_ - 1); // 刷新上一行
-    refresh_line(cursor_row_);     // 刷新当前行
+    if (!scrolled) {
+        refresh_line(cursor_row_); // 刷新当前行
+    }
     
     unsaved_changes_ = true;
 }
@@ -188,6 +199,9 @@ void TextEditor::backspace() {
         lines_[cursor_row_] += current_line;
         last_updated_row_ = -1; // 需要刷新所有行
         unsaved_changes_ = true;
+        if (cursor_row_ < top_row_) {
+            top_row_ = cursor_row_;
+        }
         refresh_display();
     }
 }
@@ -227,6 +241,7 @@ bool TextEditor::load_from_file(const std::string& filename) {
     cursor_row_ = 0;
     cursor_col_ = 0;
     last_updated_row_ = -1;
+    top_row_ = 0;
     unsaved_changes_ = false;
     refresh_display();
     
@@ -250,6 +265,7 @@ void TextEditor::set_cursor_position(int row, int col) {
     cursor_row_ = std::max(0, std::min(row, static_cast<int>(lines_.size()) - 1));
     ensure_line_exists(cursor_row_);
     cursor_col_ = std::max(0, std::min(col, static_cast<int>(lines_[cursor_row_].length())));
+    ensure_cursor_visible();
 }
 
 const std::vector<std::string>& TextEditor::get_lines() const {
@@ -268,11 +284,11 @@ bool TextEditor::has_unsaved_changes() const {
 }
 
 void TextEditor::refresh_line(int line_num) {
-    if (line_num < 0 || line_num >= static_cast<int>(lines_.size())) {
+    if (line_num < 0 || line_num >= static_cast<int>(lines_.size()) || !is_line_visible(line_num)) {
         return;
     }
     
-    auto pos = display_->calculate_text_position(0, line_num);
+    auto pos = display_->calculate_text_position(0, line_num - top_row_);
     
     // 计算需要清除的宽度：最大行宽度 + 一个字符的宽度（用于清除光标位置）
     int max_text_width = max_length_ * display_->get_font_width();
@@ -293,14 +309,61 @@ void TextEditor::refresh_line(int line_num) {
 }
 
 void TextEditor::refresh_all_lines() {
-    display_->clear_screen();
+    // 只清除文本区域，保留状态栏等区域
+    auto origin = display_->calculate_text_position(0, 0);
+    display_->fill_rect(0, origin.second, display_->get_width(),
+                        visible_rows() * display_->get_font_height(),
+                        ili9488_colors::rgb666::BLACK);
     
-    for (int i = 0; i < static_cast<int>(lines_.size()) && i < max_lines_; ++i) {
-        auto pos = display_->calculate_text_position(0, i);
+    int last = std::min({static_cast<int>(lines_.size()), max_lines_, top_row_ + visible_rows()});
+    for (int i = top_row_; i < last; ++i) {
+        auto pos = display_->calculate_text_position(0, i - top_row_);
         display_->draw_text(lines_[i], pos.first, pos.second);
     }
 }
 
+int TextEditor::visible_rows() const {
+    return std::max(1, display_->get_max_text_rows());
+}
+
+bool TextEditor::is_line_visible(int line_num) const {
+    return line_num >= top_row_ && line_num < top_row_ + visible_rows();
+}
+
+bool TextEditor::ensure_cursor_visible() {
+    int rows = visible_rows();
+    int delta = 0;
+    if (cursor_row_ < top_row_) {
+        delta = cursor_row_ - top_row_;
+    } else if (cursor_row_ >= top_row_ + rows) {
+        delta = cursor_row_ - (top_row_ + rows - 1);
+    }
+    if (delta == 0) {
+        return false;
+    }
+    
+    top_row_ += delta;
+    
+    // 显示器支持滚动时只重绘新露出的行，否则重绘整个文本区域
+    if (std::abs(delta) < rows && display_->scroll_text_rows(delta)) {
+        int first = delta > 0 ? top_row_ + rows - delta : top_row_;
+        for (int i = first; i < first + std::abs(delta); ++i) {
+            if (i < static_cast<int>(lines_.size())) {
+                refresh_line(i);
+            } else {
+                auto pos = display_->calculate_text_position(0, i - top_row_);
+                display_->fill_rect(pos.first, pos.second,
+                                    display_->get_width() - pos.first,
+                                    display_->get_font_height(),
+                                    ili9488_colors::rgb666::BLACK);
+            }
+        }
+    } else {
+        refresh_all_lines();
+    }
+    return true;
+}
+
 bool TextEditor::is_valid_position(int row, int col) const {
     return row >= 0 && row < static_cast<int>(lines_.size()) &&
            col >= 0 && col <= static_cast<int>(lines_[row].length());
@@ -327,7 +390,11 @@ void TextEditor::draw_char_at_position(char ch, int row, int col) {
         return;
     }
     
-    auto pos = display_->calculate_text_position(col, row);
+    if (!is_line_visible(row)) {
+        return;
+    }
+    
+    auto pos = display_->calculate_text_position(col, row - top_row_);
     
     // 清除字符位置
     display_->fill_rect(pos.first, pos.second, 
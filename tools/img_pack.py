@@ -0,0 +1,395 @@
+#!/usr/bin/env python3
+"""
+img_pack.py - 将PNG/PPM图片打包为ILI9488流式解码格式（PIMG）
+
+格式与 include/ili9488/ili9488_image.hpp 中的 ImageDecoder 一致：
+  - rgb666: 6位通道上的QOI式行程编码，适合照片和渐变
+  - pal4:   不超过16色的调色板 + 行程编码，适合图标和界面素材
+  - auto:   颜色数不超过16时两种格式都编码，取较小的一种；否则使用rgb666
+
+输出文件扩展名为 .hpp/.h 时生成放在Flash中的C++数组，否则写二进制文件。
+打包后总会用参考解码器解码并与原图（量化到RGB666后）逐像素比较，
+同时输出解码后RGB666字节流的FNV-1a校验值，供设备端黄金测试比对。
+
+用法：
+  python3 tools/img_pack.py logo.png -o logo.hpp --name logo
+  python3 tools/img_pack.py --test-card 160x120 -o test_card.hpp --name test_card
+  python3 tools/img_pack.py --test-card 160x120 --flat --format pal4 -o card.hpp
+
+只依赖Python标准库（PNG通过zlib解码，支持8位灰度/RGB/RGBA/调色板，非隔行）。
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = b"PIMG"
+VERSION = 1
+FORMAT_RGB666 = 0
+FORMAT_PAL4 = 1
+
+
+# === 图片读取 ===
+
+def read_ppm(data):
+    """读取P6（二进制）或P3（文本）PPM，返回 (宽, 高, [(r, g, b), ...])"""
+    tokens = []
+    pos = 0
+    # 头部：魔数、宽、高、最大值，允许#注释
+    while len(tokens) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while data[pos:pos + 1] not in (b"\n", b""):
+                pos += 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos])
+    magic, width, height, maxval = tokens[0], int(tokens[1]), int(tokens[2]), int(tokens[3])
+    if maxval != 255:
+        raise ValueError("only 8-bit PPM is supported")
+    if magic == b"P6":
+        raw = data[pos + 1:pos + 1 + width * height * 3]
+        values = list(raw)
+    elif magic == b"P3":
+        values = [int(v) for v in data[pos:].split()][:width * height * 3]
+    else:
+        raise ValueError("not a P3/P6 PPM file")
+    if len(values) < width * height * 3:
+        raise ValueError("PPM pixel data is truncated")
+    pixels = [tuple(values[i:i + 3]) for i in range(0, width * height * 3, 3)]
+    return width, height, pixels
+
+
+def read_png(data):
+    """读取8位非隔行PNG（灰度、RGB、调色板，可带alpha；alpha被忽略）"""
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("not a PNG file")
+    pos = 8
+    idat = b""
+    palette = None
+    width = height = color_type = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if depth != 8 or interlace != 0:
+                raise ValueError("only 8-bit non-interlaced PNG is supported")
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        filter_type = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if filter_type == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif filter_type == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif filter_type == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif filter_type == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+
+    pixels = []
+    for line in rows:
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if color_type == 3:
+                pixels.append(palette[px[0]])
+            elif color_type in (0, 4):
+                pixels.append((px[0], px[0], px[0]))
+            else:
+                pixels.append(tuple(px[:3]))
+    return width, height, pixels
+
+
+def test_card(width, height, flat):
+    """生成可复现的测试卡：8条彩条、8级灰阶、棋盘格，非flat时底部加平滑渐变"""
+    bars = [(255, 255, 255), (255, 255, 0), (0, 255, 255), (0, 255, 0),
+            (255, 0, 255), (255, 0, 0), (0, 0, 255), (0, 0, 0)]
+    pixels = []
+    for y in range(height):
+        for x in range(width):
+            band = y * 8 // height
+            if band < 4:
+                pixels.append(bars[x * 8 // width])
+            elif band < 5:
+                level = (x * 8 // width) * 255 // 7
+                pixels.append((level, level, level))
+            elif band < 6 or flat:
+                on = ((x // 8) + (y // 8)) % 2
+                pixels.append((255, 255, 255) if on else (0, 0, 0))
+            else:
+                pixels.append((x * 255 // max(width - 1, 1), 128, y * 255 // max(height - 1, 1)))
+    return width, height, pixels
+
+
+# === 编码 ===
+
+def qoi_hash(color):
+    r, g, b = color
+    return (r * 3 + g * 5 + b * 7) & 63
+
+
+def wrap(delta):
+    """把6位通道差值折回到-32..31"""
+    return ((delta + 32) & 63) - 32
+
+
+def encode_rgb666(pixels):
+    out = bytearray()
+    index = [(0, 0, 0)] * 64
+    prev = (0, 0, 0)
+    run = 0
+    for px in pixels:
+        if px == prev:
+            run += 1
+            if run == 63:
+                out.append(0xC0 | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(0xC0 | (run - 1))
+            run = 0
+
+        slot = qoi_hash(px)
+        if index[slot] == px:
+            out.append(slot)
+        else:
+            index[slot] = px
+            dr = wrap(px[0] - prev[0])
+            dg = wrap(px[1] - prev[1])
+            db = wrap(px[2] - prev[2])
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                out.append(0x80 | (dg + 32))
+                out.append(((dr - dg + 8) << 4) | (db - dg + 8))
+            else:
+                out += bytes((0xFF, px[0], px[1], px[2]))
+        prev = px
+    if run:
+        out.append(0xC0 | (run - 1))
+    return out
+
+
+def encode_pal4(pixels, palette):
+    lookup = {color: i for i, color in enumerate(palette)}
+    indices = [lookup[px] for px in pixels]
+    out = bytearray()
+    literal = []
+
+    def flush():
+        if literal:
+            out.append(len(literal) - 1)
+            padded = literal + [0] * (len(literal) % 2)
+            for i in range(0, len(padded), 2):
+                out.append((padded[i] << 4) | padded[i + 1])
+            literal.clear()
+
+    i = 0
+    while i < len(indices):
+        run = 1
+        while i + run < len(indices) and run < 128 and indices[i + run] == indices[i]:
+            run += 1
+        if run >= 3:
+            flush()
+            out.append(0x80 | (run - 1))
+            out.append(indices[i])
+            i += run
+        else:
+            literal.append(indices[i])
+            if len(literal) == 128:
+                flush()
+            i += 1
+    flush()
+    return out
+
+
+def pack(width, height, pixels, fmt):
+    """打包为PIMG字节串，pixels为6位通道颜色"""
+    if fmt == "auto":
+        if len(set(pixels)) > 16:
+            return pack(width, height, pixels, "rgb666")
+        candidates = [pack(width, height, pixels, f) for f in ("pal4", "rgb666")]
+        return min(candidates, key=lambda c: len(c[0]))
+    palette = []
+    if fmt == "pal4":
+        palette = sorted(set(pixels))
+        if len(palette) > 16:
+            raise ValueError("pal4 needs at most 16 colors after RGB666 reduction, image has %d"
+                             % len(palette))
+        body = encode_pal4(pixels, palette)
+        code = FORMAT_PAL4
+    else:
+        body = encode_rgb666(pixels)
+        code = FORMAT_RGB666
+    header = MAGIC + struct.pack("<BBHHBB", VERSION, code, width, height, len(palette), 0)
+    return header + b"".join(bytes(c) for c in palette) + body, fmt
+
+
+# === 参考解码（与ImageDecoder逐字节一致）===
+
+def decode(data):
+    """返回 (宽, 高, RGB666总线字节)"""
+    if data[:4] != MAGIC:
+        raise ValueError("bad magic")
+    _, code, width, height, palette_size, _ = struct.unpack("<BBHHBB", data[4:12])
+    palette = [tuple(data[12 + i * 3:15 + i * 3]) for i in range(palette_size)]
+    pos = 12 + palette_size * 3
+    count = width * height
+    out = bytearray()
+
+    if code == FORMAT_RGB666:
+        index = [(0, 0, 0)] * 64
+        color = (0, 0, 0)
+        while len(out) < count * 3:
+            op = data[pos]
+            pos += 1
+            repeat = 1
+            if op == 0xFF:
+                color = tuple(data[pos:pos + 3])
+                pos += 3
+            elif op >> 6 == 0:
+                color = index[op]
+            elif op >> 6 == 1:
+                color = ((color[0] + ((op >> 4) & 3) - 2) & 63,
+                         (color[1] + ((op >> 2) & 3) - 2) & 63,
+                         (color[2] + (op & 3) - 2) & 63)
+            elif op >> 6 == 2:
+                dg = (op & 63) - 32
+                rb = data[pos]
+                pos += 1
+                color = ((color[0] + dg + (rb >> 4) - 8) & 63,
+                         (color[1] + dg) & 63,
+                         (color[2] + dg + (rb & 15) - 8) & 63)
+            else:
+                repeat = (op & 63) + 1
+            if op >> 6 != 3 or op == 0xFF:
+                index[qoi_hash(color)] = color
+            out += bytes(c << 2 for c in color) * repeat
+    else:
+        while len(out) < count * 3:
+            op = data[pos]
+            pos += 1
+            if op & 0x80:
+                indices = [data[pos] & 15] * ((op & 0x7F) + 1)
+                pos += 1
+            else:
+                n = op + 1
+                packed = data[pos:pos + (n + 1) // 2]
+                pos += (n + 1) // 2
+                indices = [nibble for b in packed for nibble in (b >> 4, b & 15)][:n]
+            for i in indices:
+                out += bytes(c << 2 for c in palette[i])
+    return width, height, bytes(out[:count * 3])
+
+
+def fnv1a(data):
+    h = 0x811C9DC5
+    for b in data:
+        h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+# === 输出 ===
+
+def write_header(path, name, packed, info, source):
+    lines = [
+        "#pragma once",
+        "",
+        "// Generated by tools/img_pack.py from %s - do not edit" % source,
+        "// %s" % info,
+        "",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "",
+        "namespace assets {",
+        "",
+        "/// FNV-1a of the decoded RGB666 bytes (ImageDecoder output)",
+        "constexpr uint32_t %s_hash = 0x%08X;" % (name, fnv1a(decode(packed)[2])),
+        "",
+        "alignas(4) static const uint8_t %s[%d] = {" % (name, len(packed)),
+    ]
+    for i in range(0, len(packed), 16):
+        lines.append("    " + " ".join("0x%02X," % b for b in packed[i:i + 16]))
+    lines += ["};", "", "} // namespace assets", ""]
+    with open(path, "w", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack PNG/PPM images for the ILI9488 streaming decoder")
+    parser.add_argument("input", nargs="?", help="PNG or PPM file")
+    parser.add_argument("-o", "--output", required=True, help=".bin, or .hpp/.h for a C++ array")
+    parser.add_argument("--format", choices=("auto", "rgb666", "pal4"), default="auto")
+    parser.add_argument("--name", help="array name (default: output file name)")
+    parser.add_argument("--test-card", metavar="WxH", help="pack the built-in test card instead of a file")
+    parser.add_argument("--flat", action="store_true", help="test card without the smooth gradient (14 colors)")
+    args = parser.parse_args()
+
+    if args.test_card:
+        w, h = (int(v) for v in args.test_card.lower().split("x"))
+        width, height, pixels = test_card(w, h, args.flat)
+        source = "--test-card %s%s" % (args.test_card, " --flat" if args.flat else "")
+    elif args.input:
+        with open(args.input, "rb") as f:
+            data = f.read()
+        width, height, pixels = (read_png if data[:4] == b"\x89PNG" else read_ppm)(data)
+        source = os.path.basename(args.input)
+    else:
+        parser.error("an input file or --test-card is required")
+    if args.format != "auto":
+        source += " --format %s" % args.format
+
+    if width > 0xFFFF or height > 0xFFFF:
+        sys.exit("image too large")
+
+    pixels666 = [(r >> 2, g >> 2, b >> 2) for r, g, b in pixels]
+    packed, fmt = pack(width, height, pixels666, args.format)
+
+    # 往返校验：参考解码结果必须与量化后的原图一致
+    _, _, decoded = decode(packed)
+    expected = bytes(c << 2 for px in pixels666 for c in px)
+    if decoded != expected:
+        sys.exit("round-trip check failed")
+
+    raw = width * height * 3
+    info = "%dx%d %s, %d bytes (%.1f%% of %d raw RGB666 bytes)" % (
+        width, height, fmt, len(packed), 100.0 * len(packed) / raw, raw)
+    if args.output.endswith((".hpp", ".h")):
+        name = args.name or os.path.splitext(os.path.basename(args.output))[0]
+        write_header(args.output, name, packed, info, source)
+    else:
+        with open(args.output, "wb") as f:
+            f.write(packed)
+    print("%s -> %s" % (info, args.output))
+    print("decoded FNV-1a: 0x%08X" % fnv1a(decoded))
+
+
+if __name__ == "__main__":
+    main()